@@ -19,25 +19,76 @@
 
 #include "Precompiled.h"
 #include "Catalog.h"
+#include <algorithm>
+#include <QtConcurrent>
+#include "CatalogImage.h"
 #include "GlobalVar.h"
 #include "OptionItem.h"
+#include "SettingsSnapshot.h"
 
 namespace launchy {
 
 Catalog::Catalog()
-    : m_timestamp(0) {
+    : m_timestamp(0),
+      m_dirty(false),
+      m_modified(false),
+      m_snapshot(std::make_shared<CatalogSnapshot>()),
+      m_rankedCount(0) {
 
 }
 
 Catalog::~Catalog() {
-
+    m_compaction.waitForFinished();
 }
 
 // Load the catalog from the specified filename
 bool Catalog::load(const QString& filename) {
+    QMutexLocker loading(&m_loadMutex);
+    QElapsedTimer timer;
+    timer.start();
+
+    bool converted = false;
+    bool complete = true;
+    CatalogImage image;
+    if (image.open(filename)) {
+        m_timestamp = 0;
+        complete = loadImage(image);
+        image.close();
+    }
+    else {
+        // A damaged image is rebuilt, a catalog of an earlier version is converted
+        if (CatalogImage::isImage(filename) || !loadStream(filename)) {
+            return false;
+        }
+        qInfo() << "Catalog::load, converting catalog file to an image:" << filename;
+        converted = true;
+    }
+
+    // The changes made since the image was written
+    QVector<CatalogJournal::Entry> entries = CatalogJournal::read(filename);
+    if (!entries.isEmpty()) {
+        applyJournal(entries);
+    }
+    {
+        QMutexLocker locker(&m_mutex);
+        m_filename = filename;
+        m_journal.open(filename);
+        // Changes made while loading count too
+        m_modified = m_modified || converted || !complete || !entries.isEmpty();
+    }
+
+    qInfo() << "Catalog::load, loaded" << count() << "items and" << entries.size()
+        << "journal entries in" << timer.elapsed() << "ms";
+    logMemoryUsage();
+
+    // The items of damaged blocks are found again by a rebuild
+    return complete;
+}
+
+bool Catalog::loadStream(const QString& filename) {
     QFile inFile(filename);
     if (!inFile.open(QIODevice::ReadOnly)) {
-        qInfo() << "Catalog::load, fail to open catalog file:"
+        qInfo() << "Catalog::loadStream, fail to open catalog file:"
                 << filename;
         return false;
     }
@@ -56,40 +107,84 @@ bool Catalog::load(const QString& filename) {
         in >> item;
         addItem(item);
     }
+    publish();
 
     return true;
 }
 
 
-// Save the catalog to the specified filename
-bool Catalog::save(const QString& filename) {
-    // Prevent other threads accessing the catalog
-    QMutexLocker locker(&m_mutex);
+bool Catalog::compact(const QString& filename) {
+    QMutexLocker loading(&m_loadMutex);
+    m_compaction.waitForFinished();
 
-    QByteArray ba;
-    QDataStream out(&ba, QIODevice::ReadWrite);
-    out.setVersion(QDataStream::Qt_4_2);
+    CatalogSnapshotPtr snapshot;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_modified && filename == m_filename) {
+            return false;
+        }
+        if (filename != m_filename) {
+            // The catalog moved, its journal starts over at the new place
+            m_filename = filename;
+            m_journal.open(filename);
+        }
 
-    for (int i = 0; i < count(); i++) {
-        CatItem item = getItem(i);
-        out << item;
+        // Save the current contents, including changes not published yet,
+        // the changes made from now on go to a new journal
+        snapshot.reset(createSnapshot());
+        m_journal.rotate();
+        m_modified = false;
     }
 
-    // Compress and write the catalog to the specified file
-    QFile file(filename);
-    if (!file.open(QIODevice::WriteOnly)) {
-        qWarning("Catalog::save, Could not open catalog file for writing");
-        return false;
-    }
-    file.write(qCompress(ba));
+    m_compaction = QtConcurrent::run([this, filename, snapshot]() {
+        if (!CatalogImage::write(filename, *snapshot)) {
+            // The rotated journal is kept and the next compaction tries again
+            QMutexLocker locker(&m_mutex);
+            m_modified = true;
+            return false;
+        }
+        CatalogJournal::discardRotated(filename);
+        return true;
+    });
     return true;
 }
 
+// Save the catalog to the specified filename
+bool Catalog::save(const QString& filename) {
+    if (!compact(filename)) {
+        return true;
+    }
+    m_compaction.waitForFinished();
+    return m_compaction.result();
+}
+
 
 void Catalog::incrementTimestamp() {
     ++m_timestamp;
 }
 
+void Catalog::publish() {
+    QMutexLocker locker(&m_mutex);
+    publishSnapshot();
+}
+
+CatalogSnapshotPtr Catalog::snapshot() const {
+    return std::atomic_load(&m_snapshot);
+}
+
+void Catalog::journal(CatalogJournal::Operation operation, const CatItem& item) {
+    m_modified = true;
+    m_journal.append(operation, item);
+}
+
+void Catalog::publishSnapshot() {
+    m_journal.flush();
+    if (m_dirty) {
+        std::atomic_store(&m_snapshot, CatalogSnapshotPtr(createSnapshot()));
+        m_dirty = false;
+    }
+}
+
 // Return true if the specified catalog item matches the specified string
 bool Catalog::matches(CatItem* item, const QString& match) {
     int matchLength = match.count();
@@ -119,48 +214,119 @@ bool Catalog::matches(CatItem* item, const QString& match) {
 
 // Search the catalog, for items matching the text parameter and
 // populate the out parameter
-void Catalog::searchCatalogs(const QString& text, QList<CatItem>& result) {
-    // Prevent other threads accessing the catalog
-    QMutexLocker locker(&m_mutex);
+void Catalog::searchCatalogs(const QString& text, QList<CatItem>& result,
+                             const SearchControl* control) {
+    // Only other searches are locked out, the catalog builder keeps
+    // working on the next snapshot meanwhile
+    QMutexLocker locker(&m_searchMutex);
+
+    // Indices of the previous searches are only valid in their own snapshot
+    CatalogSnapshotPtr current = snapshot();
+    if (current != m_searchSnapshot) {
+        invalidateSearch();
+        m_searchSnapshot = current;
+    }
 
-    QList<CatItem*> catMatches = search(text);
-    qDebug() << "Catalog::searchCatalogs, search matched count:" << catMatches.count();
-    // Now prioritize the catalog items
-    qSort(catMatches.begin(), catMatches.end(), CatLessPtr);
+    // Narrow down the matches of the previous query if text extends it
+    int edits = CatalogSnapshot::fuzzyEdits(text);
+    QVector<int> matched = current->search(text, m_session.candidates(text, edits), control);
+    if (control && control->isCancelled()) {
+        return;
+    }
+
+    // Matches cut short by the time budget must not narrow later searches
+    if (control && control->isExpired()) {
+        qWarning() << "Catalog::searchCatalogs, time budget used up after"
+            << control->elapsed() << "ms, partial matches:" << matched.count();
+    }
+    else {
+        m_session.store(text, matched, edits);
+    }
+    qDebug() << "Catalog::searchCatalogs, search matched count:" << matched.count();
 
     // Check for history matches, and put them in the front
-    QString location = "History/" + text;
-    QStringList hist = g_settings->value(location).toStringList();
-    if (hist.count() == 2) {
-        for (int i = 0; i < catMatches.count(); ++i) {
-            if (catMatches[i]->shortName == hist[0] && catMatches[i]->fullPath == hist[1]) {
-                CatItem* tmp = catMatches[i];
-                catMatches.removeAt(i);
-                catMatches.push_front(tmp);
+    int front = 0;
+    QString shortName, fullPath;
+    if (m_choices.choice(text, shortName, fullPath)) {
+        for (int i = 0; i < matched.count(); ++i) {
+            if (current->isSameItem(matched[i], shortName, fullPath)) {
+                std::swap(matched[front++], matched[i]);
             }
         }
     }
 
-    // Load up the results
-    int max = g_settings->value(OPSTION_NUMRESULT, OPSTION_NUMRESULT_DEFAULT).toInt();
-    for (int i = 0; i < max && i < catMatches.count(); i++) {
-        result.push_back(*catMatches[i]);
+    // Now prioritize the catalog items, only the results
+    // which are shown need to be put in order
+    int max = SettingsSnapshot::current()->numResult;
+    int last = qBound(front, max, matched.count());
+    current->sortMatches(matched, front, last, text);
+
+    // Load up the results, only the items shown are copied out of the catalog
+    for (int i = 0; i < last; i++) {
+        result.push_back(current->item(matched[i]));
     }
+
+    m_rankedText = text;
+    m_ranked.swap(matched);
+    m_rankedCount = last;
+}
+
+void Catalog::searchPrefix(const QString& text, QList<CatItem>& result,
+                           const SearchControl* control) const {
+    // Nothing is cached, so the full search is not locked out
+    CatalogSnapshotPtr current = snapshot();
+    QVector<int> matched = current->searchPrefix(text, control);
+    if (control && control->isCancelled()) {
+        return;
+    }
+
+    int max = SettingsSnapshot::current()->numResult;
+    int last = qMin(max, matched.count());
+    current->sortMatches(matched, 0, last, text);
+    for (int i = 0; i < last; i++) {
+        result.push_back(current->item(matched[i]));
+    }
+    qDebug() << "Catalog::searchPrefix, prefix matched count:" << matched.count();
+}
+
+bool Catalog::searchMore(const QString& text, int count, QList<CatItem>& result) {
+    QMutexLocker locker(&m_searchMutex);
+
+    if (text.isEmpty() || text != m_rankedText || m_rankedCount >= m_ranked.count()) {
+        return false;
+    }
+
+    // Keep paging through the snapshot of the search, even if
+    // a newer one has been published since
+    int last = qMin(m_rankedCount + count, m_ranked.count());
+    m_searchSnapshot->sortMatches(m_ranked, m_rankedCount, last, text);
+    for (int i = m_rankedCount; i < last; ++i) {
+        result.push_back(m_searchSnapshot->item(m_ranked[i]));
+    }
+    qDebug() << "Catalog::searchMore, ranked" << last - m_rankedCount
+        << "more of" << m_ranked.count() << "matches";
+    m_rankedCount = last;
+    return true;
+}
+
+void Catalog::invalidateSearch() {
+    m_session.clear();
+    m_rankedText.clear();
+    m_ranked.clear();
+    m_rankedCount = 0;
 }
 
 void Catalog::promoteRecentlyUsedItems(const QString& text, QList<CatItem>& list) {
     // Check for history matches
-    QString location = "History/" + text;
-    QStringList hist = g_settings->value(location).toStringList();
-    qDebug() << "Catalog::promoteRecentlyUsedItems, text:"
-        << text << "hist" << hist << "hist count:" << hist.count();
-
-    if (hist.count() != 2) {
+    QString shortName, fullPath;
+    if (!m_choices.choice(text, shortName, fullPath)) {
         return;
     }
+    qDebug() << "Catalog::promoteRecentlyUsedItems, text:"
+        << text << "choice:" << shortName << fullPath;
 
     for (int i = 0; i < list.count(); i++) {
-        if (list[i].shortName == hist[0] && list[i].fullPath == hist[1]) {
+        if (list[i].shortName == shortName && list[i].fullPath == fullPath) {
             CatItem tmp = list[i];
             qDebug() << "Catalog::promoteRecentlyUsedItems, promoted:" << tmp.fullPath;
             list.removeAt(i);
@@ -170,8 +336,12 @@ void Catalog::promoteRecentlyUsedItems(const QString& text, QList<CatItem>& list
     }
 }
 
+RecentChoices& Catalog::recentChoices() {
+    return m_choices;
+}
+
 QString Catalog::decorateText(const QString& text, const QString& match, bool outputRichText) {
-    if (!g_settings->value(OPSTION_DECORATETEXT, OPSTION_DECORATETEXT_DEFAULT).toBool())
+    if (!SettingsSnapshot::current()->decorateText)
         return text;
     QString decoratedText;
     int matchLength = match.count();
@@ -218,77 +388,228 @@ QString Catalog::decorateText(const QString& text, const QString& match, bool ou
 }
 
 
-SlowCatalog::SlowCatalog()
-    : Catalog() {
+#ifdef LAUNCHY_CHECK_MATCHER
+// The packed matcher must agree with Catalog::matches. Builds configured
+// with check_matcher compare them once on random names, long enough to
+// cross the vector widths
+static const quint32 CHECK_MATCHER_SEED = 12345;
+
+static void checkMatcher() {
+    static const ushort alphabet[] = { 'a', 'b', 'c', 'A', 'B', ' ', '-', 0xE9, 0x4E2D };
+    const int letters = sizeof(alphabet) / sizeof(alphabet[0]);
+    // A fixed sequence, so that a failure can be reproduced
+    quint32 seed = CHECK_MATCHER_SEED;
+    auto next = [&seed](int bound) {
+        seed = seed * 1103515245u + 12345u;
+        return int((seed >> 16) % bound);
+    };
+
+    CatalogColumns columns;
+    QList<CatItem> items;
+    for (int i = 0; i < 512; ++i) {
+        QString name;
+        int length = next(80);
+        for (int j = 0; j < length; ++j) {
+            name += QChar(alphabet[next(letters)]);
+        }
+        CatItem item("/check/" + QString::number(i), name);
+        columns.append(item, 0);
+        items.push_back(item);
+    }
 
+    for (int q = 0; q < 64; ++q) {
+        QString query;
+        int length = 1 + next(6);
+        for (int j = 0; j < length; ++j) {
+            query += QChar(alphabet[next(letters)]).toLower();
+        }
+        for (int i = 0; i < items.size(); ++i) {
+            if (columns.matches(i, query) != Catalog::matches(&items[i], query)) {
+                qWarning() << "checkMatcher, seed" << CHECK_MATCHER_SEED << "query" << q
+                    << "name" << i << ": mismatch for" << query << "in" << items[i].shortName;
+                return;
+            }
+        }
+    }
+    qInfo() << "checkMatcher, packed matcher agrees on" << items.size() << "names";
+}
+#endif
+
+SlowCatalog::SlowCatalog()
+    : Catalog(),
+      m_firstAdded(0) {
+    qInfo() << "SlowCatalog::SlowCatalog, subsequence matcher:"
+        << SubsequenceMatcher::implementation();
+#ifdef LAUNCHY_CHECK_MATCHER
+    checkMatcher();
+#endif
 }
 
 int SlowCatalog::count() {
-    return m_catalogItems.count();
+    return snapshot()->count();
 }
 
 
 void SlowCatalog::clear() {
+    // Prevent other threads accessing the catalog
+    QMutexLocker locker(&m_mutex);
+
     m_catalogItems.clear();
+    m_columns.clear();
+    m_strings.clear();
+    m_identities.clear();
+    m_firstAdded = 0;
+    itemsRemoved();
+    m_dirty = true;
+    publishSnapshot();
 }
 
 void SlowCatalog::addItem(const CatItem& item) {
     // Prevent other threads accessing the catalog
     QMutexLocker locker(&m_mutex);
 
-    bool replaced = false;
+    // If we're not loading the catalog, an existing matching catalog item is replaced,
+    // items found again unchanged by a rebuild are not journaled
+    if (storeItem(item, m_timestamp > 0)) {
+        journal(CatalogJournal::AddItem, item);
+    }
+}
 
-    if (m_timestamp > 0) {
-        // If we're not loading the catalog, search for an existing matching catalog item
-        // and replace it if it exists
-        for (int i = 0; i < m_catalogItems.size(); ++i) {
-            if (item == m_catalogItems[i]) {
-                int usage = m_catalogItems[i].usage;
-                m_catalogItems[i] = CatalogItem(item, m_timestamp);
-                m_catalogItems[i].usage = usage;
-                replaced = true;
-                break;
+void SlowCatalog::addItems(const QList<CatItem>& items) {
+    // Prevent other threads accessing the catalog
+    QMutexLocker locker(&m_mutex);
+
+    foreach(const CatItem& item, items) {
+        if (storeItem(item, m_timestamp > 0)) {
+            journal(CatalogJournal::AddItem, item);
+        }
+    }
+}
+
+bool SlowCatalog::storeItem(const CatItem& item, bool replace) {
+    // Published with the next batch
+    m_dirty = true;
+
+    if (replace) {
+        int i = findItem(item);
+        if (i >= 0) {
+            // Keep the usage from the catalog column
+            CatalogItem row(item, m_strings);
+            const CatalogItem& old = m_catalogItems[i];
+            bool changed = row.iconPath != old.iconPath || row.pluginId != old.pluginId;
+            m_catalogItems[i] = row;
+            m_columns.setTimestamp(i, m_timestamp);
+            if (!m_columns.sameNames(i, item)) {
+                m_columns.rename(i, item);
+                itemIndexed(i);
+                changed = true;
             }
+            return changed;
         }
     }
 
-    if (!replaced) {
-        // If no match found, append the item to the catalog
-        // qDebug() << "SlowCatalog::addItem, Adding" << item.fullPath;
-        m_catalogItems.push_back(CatalogItem(item, m_timestamp));
+    // If no match found, append the item to the catalog
+    // qDebug() << "SlowCatalog::addItem, Adding" << item.fullPath;
+    m_catalogItems.push_back(CatalogItem(item, m_strings));
+    m_columns.append(item, m_timestamp);
+    const CatalogItem& row = m_catalogItems.last();
+    CatalogIdentity identity = { row.directory, row.leaf, row.shortName };
+    if (!m_identities.contains(identity)) {
+        m_identities.insert(identity, m_catalogItems.size() - 1);
     }
+    if (m_timestamp == 0) {
+        m_firstAdded = m_catalogItems.size();
+    }
+    itemIndexed(m_catalogItems.size() - 1);
+    return true;
 }
 
+// Removed rows are only marked, moving the rows after them would mean
+// reindexing the whole catalog. They are dropped by the next purge, or
+// once they make up a quarter of the rows.
+void SlowCatalog::removeItems(const QList<CatItem>& items) {
+    if (items.isEmpty()) {
+        return;
+    }
 
-void SlowCatalog::purgeOldItems() {
     // Prevent other threads accessing the catalog
     QMutexLocker locker(&m_mutex);
 
-    for (int i = m_catalogItems.size() - 1; i >= 0; --i) {
-        if (m_catalogItems.at(i).m_timestamp < m_timestamp) {
-            qDebug() << "SlowCatalog::purgeOldItems, Removing" << m_catalogItems.at(i).fullPath;
-            m_catalogItems.remove(i);
+    foreach(const CatItem& item, items) {
+        int i = findItem(item);
+        if (i >= 0) {
+            removeRow(i);
+            journal(CatalogJournal::RemoveItem, item);
         }
     }
+
+    if (m_columns.removedCount() > m_catalogItems.size() / 4) {
+        removeRows(QVector<bool>(m_catalogItems.size(), true));
+    }
 }
 
 
-void SlowCatalog::incrementUsage(const CatItem& item) {
+void SlowCatalog::purgeOldItems() {
     // Prevent other threads accessing the catalog
     QMutexLocker locker(&m_mutex);
 
+    QElapsedTimer timer;
+    timer.start();
+
+    // Items not seen by the current generation are stale,
+    // removed rows are dropped along with them
+    QVector<bool> keep(m_catalogItems.size());
+    int added = 0;
+    int kept = 0;
+    int dropped = 0;
+    int removed = m_columns.removedCount();
     for (int i = 0; i < m_catalogItems.size(); ++i) {
-        if (item == m_catalogItems[i]) {
-            // If an item is currently demoted, return it to a usage count of 1
-            if (m_catalogItems[i].usage < 0) {
-                m_catalogItems[i].usage = 1;
-            }
-            else {
-                ++m_catalogItems[i].usage;
+        keep[i] = m_columns.timestamp(i) >= m_timestamp;
+        if (keep[i] && i < m_firstAdded) {
+            ++kept;
+        }
+        else if (keep[i]) {
+            ++added;
+        }
+        else if (!m_columns.isRemoved(i)) {
+            ++dropped;
+        }
+    }
+
+    if (dropped > 0 || removed > 0) {
+        const QVector<QString>& strings = m_strings.strings();
+        for (int i = 0; i < m_catalogItems.size(); ++i) {
+            if (!keep[i] && !m_columns.isRemoved(i)) {
+                CatItem item;
+                m_catalogItems[i].fill(item, strings);
+                journal(CatalogJournal::RemoveItem, item);
             }
-            break;
         }
+        removeRows(keep);
     }
+    m_firstAdded = m_catalogItems.size();
+    publishSnapshot();
+
+    qInfo() << "SlowCatalog::purgeOldItems, generation" << m_timestamp
+        << "added:" << added << "kept:" << kept << "dropped:" << dropped
+        << "in" << timer.elapsed() << "ms";
+    reportMemoryUsage();
+}
+
+
+void SlowCatalog::incrementUsage(const CatItem& item) {
+    // Prevent other threads accessing the catalog
+    QMutexLocker locker(&m_mutex);
+
+    int i = findItem(item);
+    if (i >= 0) {
+        // If an item is currently demoted, return it to a usage count of 1
+        int usage = m_columns.usage(i);
+        m_columns.setUsage(i, usage < 0 ? 1 : usage + 1);
+        journalUsage(i);
+        m_dirty = true;
+    }
+    publishSnapshot();
 }
 
 
@@ -296,39 +617,298 @@ void SlowCatalog::demoteItem(const CatItem& item) {
     // Prevent catalog refreshes whilst searching
     QMutexLocker locker(&m_mutex);
 
+    int i = findItem(item);
+    if (i >= 0) {
+        // If an item is not demoted, demote it
+        // otherwise demote it further
+        int usage = m_columns.usage(i);
+        m_columns.setUsage(i, usage > 0 ? -1 : usage - 1);
+        journalUsage(i);
+        m_dirty = true;
+    }
+    publishSnapshot();
+}
+
+void SlowCatalog::journalUsage(int i) {
+    CatItem item;
+    m_catalogItems[i].fill(item, m_strings.strings());
+    item.usage = m_columns.usage(i);
+    journal(CatalogJournal::SetUsage, item);
+}
+
+
+void SlowCatalog::logMemoryUsage() const {
+    QMutexLocker locker(&m_mutex);
+    reportMemoryUsage();
+}
+
+void SlowCatalog::reportMemoryUsage() const {
+    int count = m_catalogItems.size();
+    if (count == 0) {
+        return;
+    }
+
+    // The rows as they are, and as they would be with every item keeping
+    // its own full path and icon path
+    const QVector<QString>& strings = m_strings.strings();
+    qint64 rows = (m_catalogItems.capacity() - count) * sizeof(CatalogItem);
+    qint64 plainRows = 0;
+    foreach(const CatalogItem& row, m_catalogItems) {
+        rows += row.memoryUsage();
+        plainRows += sizeof(CatItem) + stringMemoryUsage(row.shortName)
+            + stringMemoryUsage(strings[row.directory].size() + row.leaf.size());
+        if (row.iconPath != 0) {
+            plainRows += stringMemoryUsage(strings[row.iconPath].size());
+        }
+    }
+    qint64 pool = m_strings.memoryUsage();
+    qint64 identities = m_identities.capacity() * sizeof(void*)
+        + m_identities.size() * (sizeof(void*) + sizeof(uint) + sizeof(CatalogIdentity) + sizeof(int));
+    qint64 shared = m_columns.memoryUsage() + identities + indexMemoryUsage();
+
+    qInfo() << "SlowCatalog::logMemoryUsage," << count << "items,"
+        << m_strings.count() << "interned strings, bytes per item:"
+        << (rows + pool + shared) / count << "(rows" << rows / count
+        << "strings" << pool / count << "columns and index" << shared / count << "),"
+        << "without interning:" << (plainRows + shared) / count;
+}
+
+int SlowCatalog::findItem(const CatItem& item) const {
+    int split = CatalogItem::splitPosition(item.fullPath);
+    int directory = m_strings.find(item.fullPath.left(split));
+    if (directory < 0) {
+        return -1;
+    }
+    CatalogIdentity identity = { directory, item.fullPath.mid(split), item.shortName };
+    return m_identities.value(identity, -1);
+}
+
+void SlowCatalog::removeRows(QVector<bool> keep) {
+    // Move the remaining rows down in one pass, keeping their order
+    int remaining = 0;
+    int firstAdded = 0;
     for (int i = 0; i < m_catalogItems.size(); ++i) {
-        if (item == m_catalogItems[i]) {
-            // If an item is not demoted, demote it
-            if (m_catalogItems[i].usage > 0) {
-                m_catalogItems[i].usage = -1;
+        if (m_columns.isRemoved(i)) {
+            keep[i] = false;
+        }
+        if (keep[i]) {
+            if (remaining != i) {
+                m_catalogItems[remaining] = m_catalogItems[i];
             }
-            else { // otherwise demote it further
-                --m_catalogItems[i].usage;
+            ++remaining;
+            if (i < m_firstAdded) {
+                firstAdded = remaining;
             }
-            break;
         }
     }
+    m_catalogItems.resize(remaining);
+    m_firstAdded = firstAdded;
+    m_columns.retain(keep);
+
+    compactStrings();
+    rebuildIdentities();
+    itemsRemoved();
+    m_dirty = true;
 }
 
+// Only the identity of the row goes, a duplicate of the row is found
+// again once removeRows() rebuilds the identities
+void SlowCatalog::removeRow(int i) {
+    const CatalogItem& row = m_catalogItems[i];
+    CatalogIdentity identity = { row.directory, row.leaf, row.shortName };
+    m_identities.remove(identity);
+    m_columns.remove(i);
+    m_dirty = true;
+}
 
-const CatItem& SlowCatalog::getItem(int i) {
-    return m_catalogItems[i];
+// Removing rows shifts the indices of all following rows
+void SlowCatalog::rebuildIdentities() {
+    m_identities.clear();
+    m_identities.reserve(m_catalogItems.size());
+    for (int i = m_catalogItems.size() - 1; i >= 0; --i) {
+        const CatalogItem& row = m_catalogItems[i];
+        CatalogIdentity identity = { row.directory, row.leaf, row.shortName };
+        m_identities.insert(identity, i);
+    }
+}
+
+void SlowCatalog::compactStrings() {
+    StringPool strings;
+    const QVector<QString>& old = m_strings.strings();
+    for (int i = 0; i < m_catalogItems.size(); ++i) {
+        CatalogItem& row = m_catalogItems[i];
+        row.directory = strings.intern(old[row.directory]);
+        row.iconPath = strings.intern(old[row.iconPath]);
+    }
+    m_strings = strings;
+}
+
+CatalogSnapshot* SlowCatalog::createSnapshot() const {
+    return new CatalogSnapshot(m_catalogItems, m_columns, m_strings.strings());
 }
 
-// Return a list of catalog items that match searchText
-// this method should only be called from within a QMutexLocker protected section
-QList<CatItem*> SlowCatalog::search(const QString& searchText) {
-    QList<CatItem*> result;
-    if (!searchText.isEmpty()) {
-        QString lowSearch = searchText.toLower();
-        for (int i = 0; i < m_catalogItems.count(); ++i) {
-            if (matches(&m_catalogItems[i], lowSearch)) {
-                result.push_back(&m_catalogItems[i]);
+// The rows and columns are filled from the decoded image blocks
+// without going through addItem for every item
+bool SlowCatalog::loadImage(const CatalogImage& image) {
+    QElapsedTimer timer;
+    timer.start();
+
+    {
+        // Prevent other threads accessing the catalog
+        QMutexLocker locker(&m_mutex);
+        m_catalogItems.clear();
+        m_columns.clear();
+        m_identities.clear();
+        m_firstAdded = 0;
+        itemsRemoved();
+        m_strings.assign(image.pool());
+        m_catalogItems.reserve(image.count());
+    }
+
+    // A batch of blocks is decoded in parallel outside of the lock, then
+    // appended and published, so searches made while the catalog loads
+    // see the items loaded so far
+    bool complete = true;
+    int batch = qMax(1, QThread::idealThreadCount());
+    for (int first = 0; first < image.blockCount(); first += batch) {
+        QVector<CatalogImage::Block> blocks = image.readBlocks(first, batch);
+
+        QMutexLocker locker(&m_mutex);
+        foreach(const CatalogImage::Block& block, blocks) {
+            complete = complete && block.valid;
+            appendBlock(block);
+        }
+        m_dirty = true;
+        publishSnapshot();
+
+        if (first == 0) {
+            qInfo() << "SlowCatalog::loadImage, first" << m_catalogItems.size()
+                << "items searchable after" << timer.elapsed() << "ms";
+        }
+    }
+    return complete;
+}
+
+void SlowCatalog::appendBlock(const CatalogImage::Block& block) {
+    int offset = m_columns.appendNames(block.names);
+    for (int j = 0; j < block.rows.size(); ++j) {
+        const CatalogImage::Record& record = block.records[j];
+        const CatalogItem& row = block.rows[j];
+        int i = m_catalogItems.size();
+        m_catalogItems.push_back(row);
+        m_columns.appendItem(offset + record.namesOffset, record.lowerLength,
+                             record.transLength, record.usage, row.shortName.size(), m_timestamp);
+
+        CatalogIdentity identity = { row.directory, row.leaf, row.shortName };
+        if (!m_identities.contains(identity)) {
+            m_identities.insert(identity, i);
+        }
+        itemIndexed(i);
+    }
+    m_firstAdded = m_catalogItems.size();
+}
+
+void SlowCatalog::applyJournal(const QVector<CatalogJournal::Entry>& entries) {
+    // Prevent other threads accessing the catalog
+    QMutexLocker locker(&m_mutex);
+
+    // Removed rows are dropped together at the end, a row added again
+    // later in the journal is kept
+    QVector<bool> keep(m_catalogItems.size(), true);
+    foreach(const CatalogJournal::Entry& entry, entries) {
+        if (entry.operation == CatalogJournal::AddItem) {
+            int i = findItem(entry.item);
+            storeItem(entry.item, true);
+            if (i < 0) {
+                keep.push_back(true);
+            }
+            else {
+                keep[i] = true;
             }
+            continue;
+        }
+
+        int i = findItem(entry.item);
+        if (i < 0) {
+            continue;
+        }
+        if (entry.operation == CatalogJournal::RemoveItem) {
+            keep[i] = false;
         }
+        else {
+            m_columns.setUsage(i, entry.item.usage);
+        }
+    }
+
+    if (keep.contains(false)) {
+        removeRows(keep);
     }
+    m_dirty = true;
+    publishSnapshot();
+}
+
+qint64 SlowCatalog::indexMemoryUsage() const {
+    return 0;
+}
+
+void SlowCatalog::itemIndexed(int i) {
+    Q_UNUSED(i)
+}
+
+void SlowCatalog::itemsRemoved() {
+}
+
+
+FastCatalog::FastCatalog()
+    : SlowCatalog() {
 
-    return result;
+}
+
+CatalogSnapshot* FastCatalog::createSnapshot() const {
+    return new FastCatalogSnapshot(m_catalogItems, m_columns, m_strings.strings(), m_postings);
+}
+
+qint64 FastCatalog::indexMemoryUsage() const {
+    qint64 bytes = m_postings.capacity() * sizeof(void*);
+    for (auto it = m_postings.constBegin(); it != m_postings.constEnd(); ++it) {
+        bytes += sizeof(void*) + sizeof(uint) + sizeof(ushort) + sizeof(QVector<int>)
+            + it->capacity() * sizeof(int);
+    }
+    return bytes;
+}
+
+// Add item i to the posting list of every character of its search names,
+// the posting lists are kept sorted by item index
+void FastCatalog::itemIndexed(int i) {
+    const ushort* names = m_columns.names(i);
+    int length = m_columns.namesLength(i);
+    for (int j = 0; j < length; ++j) {
+        QVector<int>& posting = m_postings[names[j]];
+        if (posting.isEmpty() || posting.last() < i) {
+            posting.push_back(i);
+        }
+        else if (posting.last() != i) {
+            // The item has been renamed in place, insert it at its sorted position
+            QVector<int>::iterator it = std::lower_bound(posting.begin(), posting.end(), i);
+            if (*it != i) {
+                posting.insert(it, i);
+            }
+        }
+    }
+}
+
+// Dropping items shifts the indices of all following items, so the whole
+// index has to be rebuilt. Rows only marked removed stay in their posting
+// lists until then, the snapshots skip them.
+void FastCatalog::itemsRemoved() {
+    rebuildIndex();
+}
+
+void FastCatalog::rebuildIndex() {
+    m_postings.clear();
+    for (int i = 0; i < m_catalogItems.size(); ++i) {
+        itemIndexed(i);
+    }
 }
 
 bool CatLessRef(CatItem& a, CatItem& b) {
@@ -341,18 +921,22 @@ bool CatLessRef(CatItem& a, CatItem& b) {
     return less;
 }
 
-bool CatLessPtr(CatItem* a, CatItem* b) {
+bool CatLessPtr(const CatItem* a, const CatItem* b) {
+    return CatLess(a, b, g_searchText);
+}
+
+bool CatLess(const CatItem* a, const CatItem* b, const QString& searchText) {
     // Items with negative usage are lowest priority
     if (a->usage < 0 && b->usage >= 0)
         return false;
     if (b->usage < 0 && a->usage >= 0)
         return true;
 
-    bool localEqual = (a->searchName[CatItem::LOWER] == g_searchText
-        || a->searchName[CatItem::TRANS] == g_searchText);
+    bool localEqual = (a->searchName[CatItem::LOWER] == searchText
+        || a->searchName[CatItem::TRANS] == searchText);
 
-    bool otherEqual = (b->searchName[CatItem::LOWER] == g_searchText
-        || b->searchName[CatItem::TRANS] == g_searchText);
+    bool otherEqual = (b->searchName[CatItem::LOWER] == searchText
+        || b->searchName[CatItem::TRANS] == searchText);
 
     // Exact match between search text and item name has higest priority
     if (localEqual && !otherEqual)
@@ -360,12 +944,12 @@ bool CatLessPtr(CatItem* a, CatItem* b) {
     if (!localEqual && otherEqual)
         return false;
 
-    int localFind = std::min(a->searchName[CatItem::LOWER].indexOf(g_searchText),
-                             a->searchName[CatItem::TRANS].indexOf(g_searchText));
-    int otherFind = std::min(b->searchName[CatItem::LOWER].indexOf(g_searchText),
-                             b->searchName[CatItem::TRANS].indexOf(g_searchText));
+    int localFind = std::min(a->searchName[CatItem::LOWER].indexOf(searchText),
+                             a->searchName[CatItem::TRANS].indexOf(searchText));
+    int otherFind = std::min(b->searchName[CatItem::LOWER].indexOf(searchText),
+                             b->searchName[CatItem::TRANS].indexOf(searchText));
 
-    if (g_searchText.count() == 1) {
+    if (searchText.count() == 1) {
         // Match at the start
         if (localFind == 0 && otherFind != 0)
             return true;
@@ -419,16 +1003,4 @@ bool CatLessPtr(CatItem* a, CatItem* b) {
     // Absolute tiebreaker to prevent loops
     return a->fullPath < b->fullPath;
 }
-
-CatalogItem::CatalogItem()
-    : m_timestamp(0) {
-
-}
-
-CatalogItem::CatalogItem(const CatItem& item, int time)
-    : CatItem(item),
-      m_timestamp(time) {
-
-}
-
 }
@@ -20,52 +20,156 @@
 #pragma once
 
 #include <QVector>
+#include <QHash>
 #include <QMutex>
+#include <QFuture>
 #include "CatalogItem.h"
+#include "SearchSession.h"
+#include "CatalogColumns.h"
+#include "CatalogSnapshot.h"
+#include "CatalogJournal.h"
+#include "CatalogImage.h"
+#include "SearchControl.h"
+#include "RecentChoices.h"
 
 // These classes do not pertain to plugins
 
 namespace launchy {
-// Catalog provides methods to search and manage the indexed items
+
+// Catalog provides methods to search and manage the indexed items.
+// Changes are made under the catalog mutex and become visible to searches
+// once they are published as a new snapshot, searches only read the last
+// published snapshot and never wait for the catalog builder.
+// Changes are journaled as they are made and written to disk when they
+// are published, the catalog image is only rewritten when compacted.
 class Catalog {
 public:
     Catalog();
     virtual ~Catalog();
+    // Load a catalog image and replay its journal, a catalog in the stream
+    // format of earlier versions is loaded and saved as an image by the next
+    // compaction. May run on any thread, the items are published as they
+    // are loaded. Return false if the catalog has to be rebuilt, because
+    // the file is missing or some of its items were lost
     bool load(const QString& filename);
+    // Write the changes since the last image into a new image in the
+    // background, return false if there are none. A catalog still loading
+    // is waited for, and a new filename moves the journal there too
+    bool compact(const QString& filename);
+    // Compact and wait until the image is written
     bool save(const QString& filename);
     void incrementTimestamp();
-    void searchCatalogs(const QString& text, QList<CatItem>& result);
+    // Search may be called from any thread, when control is not null
+    // the search stops as soon as control says so
+    void searchCatalogs(const QString& text, QList<CatItem>& result,
+                        const SearchControl* control = nullptr);
+    // Quick search for the best items whose names start with text only,
+    // shown while searchCatalogs is still looking for every match
+    void searchPrefix(const QString& text, QList<CatItem>& result,
+                      const SearchControl* control = nullptr) const;
+    // Append the next count results of the last search for text,
+    // return false if text is not the last search anymore
+    bool searchMore(const QString& text, int count, QList<CatItem>& result);
     void promoteRecentlyUsedItems(const QString& text, QList<CatItem>& list);
+    // Items chosen for queries, ranked first by the searches for them
+    RecentChoices& recentChoices();
+
+    // Make the changes since the last publication visible to searches
+    void publish();
+    CatalogSnapshotPtr snapshot() const;
 
     virtual int count() = 0;
     virtual void clear() = 0;
     virtual void addItem(const CatItem& item) = 0;
+    // Add a batch of items under a single lock
+    virtual void addItems(const QList<CatItem>& items) = 0;
+    // Remove the items matching these at once, for changes seen by the watcher,
+    // the removal is published with the next batch
+    virtual void removeItems(const QList<CatItem>& items) = 0;
     virtual void purgeOldItems() = 0;
 
     virtual void incrementUsage(const CatItem& item) = 0;
     virtual void demoteItem(const CatItem& item) = 0;
 
+    // Log the approximate memory the catalog uses per item
+    virtual void logMemoryUsage() const = 0;
+
     static bool matches(CatItem* item, const QString& match);
     static QString decorateText(const QString& text, const QString& match, bool outputRichText = false);
 
 protected:
-    virtual const CatItem& getItem(int) = 0;
-    virtual QList<CatItem*> search(const QString&) = 0;
+    // Return a new snapshot of the current contents,
+    // called with the catalog mutex held
+    virtual CatalogSnapshot* createSnapshot() const = 0;
+    // Replace the contents by those of a catalog image and publish them,
+    // return false if damaged blocks of the image were skipped
+    virtual bool loadImage(const CatalogImage& image) = 0;
+    // Redo the changes of journal entries and publish them
+    virtual void applyJournal(const QVector<CatalogJournal::Entry>& entries) = 0;
+    // Record a change for the next image, must be called with the catalog mutex held
+    void journal(CatalogJournal::Operation operation, const CatItem& item);
+    // Publish the current contents if they changed since the last
+    // publication, must be called with the catalog mutex held
+    void publishSnapshot();
 
     int m_timestamp;
-    QMutex m_mutex;
+    // Guards the catalog contents, only writers take it
+    mutable QMutex m_mutex;
+    // Held for the whole of load(), so that no image is written from a
+    // partly loaded catalog and the loader cannot reopen a moved journal
+    QMutex m_loadMutex;
+    bool m_dirty;
+    // The contents differ from the last image written
+    bool m_modified;
+
+private:
+    // Load a catalog in the compressed QDataStream format of earlier versions
+    bool loadStream(const QString& filename);
+    // Forget the cached search state, called when a search
+    // finds a different snapshot than the previous one
+    void invalidateSearch();
+
+private:
+    RecentChoices m_choices;
+    CatalogSnapshotPtr m_snapshot;
+
+    // The catalog file the journal belongs to, guarded by the catalog mutex
+    QString m_filename;
+    CatalogJournal m_journal;
+    // Only one image is written at a time, the rotated journal belongs to it
+    QFuture<bool> m_compaction;
+
+    // Search state, guarded by m_searchMutex. The indices it holds refer
+    // to m_searchSnapshot, which is kept alive until the next search.
+    QMutex m_searchMutex;
+    CatalogSnapshotPtr m_searchSnapshot;
+    SearchSession m_session;
+
+    // Matches of the last search, only the first m_rankedCount are in order,
+    // the rest are ranked when more results are requested
+    QString m_rankedText;
+    QVector<int> m_ranked;
+    int m_rankedCount;
 };
 
 
-// CatalogItem is used internally to store additional
-class CatalogItem : public CatItem {
-public:
-    CatalogItem();
-    CatalogItem(const CatItem& item, int time);
+// The identity of a catalog row, its full path is kept as the interned
+// directory and the leaf name, which share their data with the row
+struct CatalogIdentity {
+    int directory;
+    QString leaf;
+    QString shortName;
 
-    int m_timestamp;
+    bool operator==(const CatalogIdentity& other) const {
+        return directory == other.directory && leaf == other.leaf
+            && shortName == other.shortName;
+    }
 };
 
+inline uint qHash(const CatalogIdentity& identity, uint seed = 0) {
+    return qHash(identity.leaf, seed) ^ qHash(identity.shortName, seed ^ identity.directory);
+}
+
 
 /** This class does not pertain to plugins */
 // The slow catalog searches slowly but
@@ -77,20 +181,89 @@ public:
     virtual int count();
     virtual void clear();
     virtual void addItem(const CatItem& item);
+    virtual void addItems(const QList<CatItem>& items);
+    virtual void removeItems(const QList<CatItem>& items);
     virtual void purgeOldItems();
 
     virtual void incrementUsage(const CatItem& item);
     virtual void demoteItem(const CatItem& item);
 
+    virtual void logMemoryUsage() const;
+
 protected:
-    virtual const CatItem& getItem(int i);
-    virtual QList<CatItem*> search(const QString& searchText);
+    virtual CatalogSnapshot* createSnapshot() const;
+    virtual bool loadImage(const CatalogImage& image);
+    virtual void applyJournal(const QVector<CatalogJournal::Entry>& entries);
+    // Approximate heap bytes of the search index, if any
+    virtual qint64 indexMemoryUsage() const;
+
+    // Called with the catalog mutex held whenever the search names
+    // of the item at index i have been added or replaced
+    virtual void itemIndexed(int i);
+    // Called with the catalog mutex held after items have been removed
+    virtual void itemsRemoved();
+
+    // Return the index of the row with the identity of item or -1
+    int findItem(const CatItem& item) const;
 
 private:
+    // Append or, when replace is true, update the row of item,
+    // return false if the catalog already held the item as it is
+    bool storeItem(const CatItem& item, bool replace);
+    // Append the rows of a decoded image block
+    void appendBlock(const CatalogImage::Block& block);
+    // Drop every row i with keep[i] false and the rows marked removed
+    void removeRows(QVector<bool> keep);
+    // Mark row i removed, it is dropped with the next removeRows()
+    void removeRow(int i);
+    // Journal the usage of row i
+    void journalUsage(int i);
+    // logMemoryUsage with the catalog mutex held
+    void reportMemoryUsage() const;
+    void rebuildIdentities();
+    // Drop the interned strings no row uses anymore
+    void compactStrings();
+
+protected:
     QVector<CatalogItem> m_catalogItems;
+    CatalogColumns m_columns;
+    // Directories and icon paths of the rows
+    StringPool m_strings;
+
+private:
+    // Row index by full path and short name, the identity CatItem::operator==
+    // compares, duplicated items map to their first row
+    QHash<CatalogIdentity, int> m_identities;
+    // Index of the first row appended by the current generation,
+    // the rows loaded or appended before it come first
+    int m_firstAdded;
+};
+
+
+// The fast catalog keeps an inverted index from every character of the
+// search names to the sorted list of items containing it. A search intersects
+// the posting lists of the query characters first, and only runs the
+// subsequence check over the remaining candidates.
+class FastCatalog : public SlowCatalog {
+public:
+    FastCatalog();
+
+protected:
+    virtual CatalogSnapshot* createSnapshot() const;
+    virtual qint64 indexMemoryUsage() const;
+    virtual void itemIndexed(int i);
+    virtual void itemsRemoved();
+
+private:
+    void rebuildIndex();
+
+private:
+    QHash<ushort, QVector<int>> m_postings;
 };
 
-bool CatLessPtr(CatItem* left, CatItem* right);
+bool CatLessPtr(const CatItem* left, const CatItem* right);
+// Same order for a given search text instead of g_searchText
+bool CatLess(const CatItem* left, const CatItem* right, const QString& searchText);
 bool CatLessRef(CatItem& left, CatItem& right);
 
 }
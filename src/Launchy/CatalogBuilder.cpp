@@ -18,11 +18,15 @@
 */
 
 #include "CatalogBuilder.h"
+#include <QElapsedTimer>
 #include <QThread>
 #include "Catalog.h"
+#include "CatalogWatcher.h"
 #include "AppBase.h"
 #include "Directory.h"
+#include "DirectoryIndexer.h"
 #include "SettingsManager.h"
+#include "OptionItem.h"
 
 #define CATALOG_PROGRESS_MIN 0
 #define CATALOG_PROGRESS_MAX 100
@@ -31,19 +35,36 @@ namespace launchy {
 
 CatalogBuilder* CatalogBuilder::s_instance = nullptr;
 
+static Catalog* createCatalog() {
+    int type = g_settings->value(OPTION_CATALOG_TYPE, OPTION_CATALOG_TYPE_DEFAULT).toInt();
+    qInfo() << "CatalogBuilder, catalog type:" << type;
+    if (type == 1) {
+        return new FastCatalog;
+    }
+    return new SlowCatalog;
+}
+
 CatalogBuilder::CatalogBuilder()
-    : m_catalog(new SlowCatalog),
+    : m_catalog(createCatalog()),
       m_thread(new QThread),
+      m_watcher(nullptr),
       m_progress(CATALOG_PROGRESS_MAX) {
     moveToThread(m_thread);
     m_thread->start(QThread::IdlePriority);
 }
 
 void CatalogBuilder::buildCatalog() {
+    build(false);
+}
+
+void CatalogBuilder::refreshCatalog() {
+    build(true);
+}
+
+void CatalogBuilder::build(bool reuseUnchanged) {
     m_progress = CATALOG_PROGRESS_MIN;
     emit catalogIncrement(m_progress);
     m_catalog->incrementTimestamp();
-    m_indexed.clear();
 
     PluginHandler& pluginHandler = PluginHandler::instance();
     QList<Directory> catDirs = SettingsManager::instance().readCatalogDirectories();
@@ -51,118 +72,64 @@ void CatalogBuilder::buildCatalog() {
     m_totalItems = catDirs.count() + pluginsInfo.count();
     m_currentItem = 0;
 
-    while (m_currentItem < catDirs.count()) {
-        QString currentDir = g_app->expandEnvironmentVars(catDirs[m_currentItem].name);
-        indexDirectory(currentDir,
-                       catDirs[m_currentItem].types,
-                       catDirs[m_currentItem].indexDirs,
-                       catDirs[m_currentItem].indexExe,
-                       catDirs[m_currentItem].depth);
-        progressStep(m_currentItem);
+    for (int i = 0; i < catDirs.count(); ++i) {
+        catDirs[i].name = g_app->expandEnvironmentVars(catDirs[i].name);
     }
 
-    // Don't call the pluginhandler to request catalog because we need to track progress
-    pluginHandler.getCatalogs(m_catalog, this);
-
-    m_catalog->purgeOldItems();
-    m_indexed.clear();
-    m_progress = CATALOG_PROGRESS_MAX;
-    emit catalogFinished();
-}
+    bool watch = g_settings->value(OPTION_CATALOG_WATCH, OPTION_CATALOG_WATCH_DEFAULT).toBool();
+    QString catalogFilename = SettingsManager::instance().catalogFilename();
+    QVector<DirectoryIndexer::ScannedDirectory> scanned;
+
+    QElapsedTimer timer;
+    timer.start();
+    {
+        int threads = g_settings->value(OPTION_CATALOG_INDEXTHREADS,
+                                        OPTION_CATALOG_INDEXTHREADS_DEFAULT).toInt();
+        int threadsPerDevice = g_settings->value(OPTION_CATALOG_INDEXTHREADSPERDEVICE,
+                                                 OPTION_CATALOG_INDEXTHREADSPERDEVICE_DEFAULT).toInt();
+        DirectoryIndexer indexer(m_catalog, threads, threadsPerDevice);
+        if (reuseUnchanged) {
+            indexer.setPrevious(DirectoryIndexer::readFingerprints(catalogFilename));
+        }
+        indexer.start(catDirs);
 
-void CatalogBuilder::indexDirectory(const QString& directory,
-                                    const QStringList& filters,
-                                    bool fdirs,
-                                    bool fbin,
-                                    int depth) {
-    QString dir = QDir::toNativeSeparators(directory);
-    QDir qDir(dir);
-    dir = qDir.absolutePath();
-    QStringList dirs = qDir.entryList(QDir::Dirs|QDir::NoDotAndDotDot);
-
-    if (depth > 0) {
-        for (int i = 0; i < dirs.count(); ++i) {
-            if (!dirs[i].startsWith(".")) {
-                QString cur = dirs[i];
-                if (!cur.contains(".lnk")) {
-#ifdef Q_OS_MAC
-                    // Special handling of app directories
-                    if (cur.endsWith(".app", Qt::CaseInsensitive)) {
-                        CatItem item(dir + "/" + cur);
-                        g_app->alterItem(&item);
-                        g_catalog->addItem(item);
-                    }
-                    else
-#endif
-                        indexDirectory(dir + "/" + dirs[i], filters, fdirs, fbin, depth-1);
-                }
-            }
+        // A directory is a step once its whole tree is indexed
+        while (indexer.waitForDirectory() >= 0) {
+            progressStep(m_currentItem);
         }
+        scanned = indexer.scannedDirectories();
+        qInfo() << "CatalogBuilder::build," << catDirs.count()
+            << "directories indexed in" << timer.elapsed() << "ms," << indexer.reusedCount()
+            << "of" << scanned.size() << "subdirectories unchanged";
     }
+    DirectoryIndexer::writeFingerprints(catalogFilename, scanned);
+
+    // Don't call the pluginhandler to request catalog because we need to track progress
+    pluginHandler.getCatalogs(m_catalog, this);
 
-    if (fdirs) {
-        for (int i = 0; i < dirs.count(); ++i) {
-            if (!dirs[i].startsWith(".") && !m_indexed.contains(dir + "/" + dirs[i])) {
-                bool isShortcut = dirs[i].endsWith(".lnk", Qt::CaseInsensitive);
+    m_catalog->purgeOldItems();
 
-                CatItem item(dir + "/" + dirs[i], !isShortcut);
-                m_catalog->addItem(item);
-                m_indexed.insert(dir + "/" + dirs[i]);
-            }
+    // Until the next build the changes of the scanned directories are applied as they come
+    if (watch) {
+        if (!m_watcher) {
+            m_watcher = new CatalogWatcher(m_catalog, this);
         }
+        m_watcher->reset(catDirs, scanned);
     }
     else {
-        // Grab any shortcut directories
-        // This is to work around a QT weirdness that treats shortcuts to directories as actual directories
-        for (int i = 0; i < dirs.count(); ++i) {
-            if (!dirs[i].startsWith(".")
-                && dirs[i].endsWith(".lnk", Qt::CaseInsensitive)) {
-                if (!m_indexed.contains(dir + "/" + dirs[i])) {
-                    CatItem item(dir + "/" + dirs[i], true);
-                    m_catalog->addItem(item);
-                    m_indexed.insert(dir + "/" + dirs[i]);
-                }
-            }
-        }
-    }
-
-    if (fbin) {
-        QStringList bins = qDir.entryList(QDir::Files | QDir::Executable);
-        for (int i = 0; i < bins.count(); ++i) {
-            if (!m_indexed.contains(dir + "/" + bins[i])) {
-                CatItem item(dir + "/" + bins[i]);
-                m_catalog->addItem(item);
-                m_indexed.insert(dir + "/" + bins[i]);
-            }
-        }
-    }
-
-    // Don't want a null file filter, that matches everything..
-    if (filters.empty()) {
-        return;
+        stopWatching();
     }
 
-    QStringList files = qDir.entryList(filters, QDir::Files | QDir::System, QDir::Unsorted);
-    for (int i = 0; i < files.count(); ++i) {
-        if (!m_indexed.contains(dir + "/" + files[i])) {
-            CatItem item(dir + "/" + files[i]);
-            g_app->alterItem(&item);
-#ifdef Q_OS_LINUX
-            if (item.fullPath.endsWith(".desktop") && item.iconPath.isEmpty()) {
-                continue;
-            }
-#endif
-            m_catalog->addItem(item);
-
-            m_indexed.insert(dir + "/" + files[i]);
-        }
-    }
+    m_progress = CATALOG_PROGRESS_MAX;
+    emit catalogFinished();
 }
 
 CatalogBuilder::~CatalogBuilder() {
     s_instance = nullptr;
     qDebug() << "CatalogBuilder::~CatalogBuilder, exit thread";
     if (m_thread) {
+        // The watcher belongs to the builder thread
+        QMetaObject::invokeMethod(this, "stopWatching", Qt::BlockingQueuedConnection);
         m_thread->exit();
         m_thread->wait();
         m_thread->deleteLater();
@@ -175,6 +142,11 @@ CatalogBuilder::~CatalogBuilder() {
     }
 }
 
+void CatalogBuilder::stopWatching() {
+    delete m_watcher;
+    m_watcher = nullptr;
+}
+
 CatalogBuilder* CatalogBuilder::instance() {
     if (!s_instance) {
         s_instance = new CatalogBuilder;
@@ -204,6 +176,9 @@ int CatalogBuilder::isRunning() const {
 bool CatalogBuilder::progressStep(int newStep) {
     newStep = newStep;
 
+    // Every directory and plugin is a batch, searches see it from now on
+    m_catalog->publish();
+
     ++m_currentItem;
     int newProgress = (int)(CATALOG_PROGRESS_MAX * (float)m_currentItem / m_totalItems);
     if (newProgress != m_progress) {
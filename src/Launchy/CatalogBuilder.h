@@ -25,6 +25,8 @@ class QThread;
 
 namespace launchy {
 
+class CatalogWatcher;
+
 class CatalogBuilder : public QObject, public INotifyProgressStep {
     Q_OBJECT
 public:
@@ -37,25 +39,32 @@ public:
     virtual bool progressStep(int newStep);
 
 public slots:
+    // List every catalog directory again
     void buildCatalog();
+    // Reuse what the last build listed of the directories which did not change.
+    // Changes within files, the contents of a .desktop file or a new execute
+    // permission, do not change their directory, only buildCatalog sees them
+    void refreshCatalog();
 
 signals:
     void catalogIncrement(int);
     void catalogFinished();
 
-private:
-    void indexDirectory(const QString& dir, const QStringList& filters,
-                        bool fdirs, bool fbin, int depth);
+private slots:
+    void stopWatching();
+
 private:
     CatalogBuilder();
+    void build(bool reuseUnchanged);
     Q_DISABLE_COPY(CatalogBuilder)
     virtual ~CatalogBuilder();
 
 private:
     Catalog* m_catalog;
     QThread* m_thread;
+    // Created in the builder thread by the first build watching the directories
+    CatalogWatcher* m_watcher;
 
-    QSet<QString> m_indexed;
     int m_progress;
     int m_currentItem;
     int m_totalItems;
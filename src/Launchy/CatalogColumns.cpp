@@ -0,0 +1,188 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CatalogColumns.h"
+#include <algorithm>
+#include "CatalogItem.h"
+
+namespace launchy {
+
+CatalogColumns::CatalogColumns()
+    : m_garbage(0),
+      m_removed(0) {
+
+}
+
+void CatalogColumns::clear() {
+    m_arena.clear();
+    m_garbage = 0;
+    m_removed = 0;
+    m_offsets.clear();
+    m_lowerLengths.clear();
+    m_transLengths.clear();
+    m_usage.clear();
+    m_shortNameLengths.clear();
+    m_timestamps.clear();
+}
+
+void CatalogColumns::append(const CatItem& item, int timestamp) {
+    m_offsets.push_back(0);
+    m_lowerLengths.push_back(0);
+    m_transLengths.push_back(0);
+    m_usage.push_back(item.usage);
+    m_shortNameLengths.push_back(item.shortName.count());
+    m_timestamps.push_back(timestamp);
+    write(item, count() - 1);
+}
+
+int CatalogColumns::appendNames(const QVector<ushort>& names) {
+    int offset = m_arena.size();
+    if (offset == 0) {
+        // Shared with the decoded block instead of copied
+        m_arena = names;
+    }
+    else {
+        m_arena += names;
+    }
+    return offset;
+}
+
+void CatalogColumns::appendItem(int offset, int lowerLength, int transLength,
+                                int usage, int shortNameLength, int timestamp) {
+    Q_ASSERT(offset >= 0 && offset + lowerLength + transLength <= m_arena.size());
+    m_offsets.push_back(offset);
+    m_lowerLengths.push_back(lowerLength);
+    m_transLengths.push_back(transLength);
+    m_usage.push_back(usage);
+    m_shortNameLengths.push_back(shortNameLength);
+    m_timestamps.push_back(timestamp);
+}
+
+void CatalogColumns::retain(const QVector<bool>& keep) {
+    QVector<ushort> arena;
+    arena.reserve(m_arena.size() - m_garbage);
+
+    int kept = 0;
+    for (int i = 0; i < count(); ++i) {
+        Q_ASSERT(!keep[i] || !isRemoved(i));
+        if (!keep[i]) {
+            continue;
+        }
+
+        // Item i is read before slot kept <= i is overwritten
+        int offset = arena.size();
+        const ushort* src = names(i);
+        arena.resize(offset + namesLength(i));
+        std::copy(src, src + namesLength(i), arena.data() + offset);
+
+        m_offsets[kept] = offset;
+        m_lowerLengths[kept] = m_lowerLengths[i];
+        m_transLengths[kept] = m_transLengths[i];
+        m_usage[kept] = m_usage[i];
+        m_shortNameLengths[kept] = m_shortNameLengths[i];
+        m_timestamps[kept] = m_timestamps[i];
+        ++kept;
+    }
+
+    m_offsets.resize(kept);
+    m_lowerLengths.resize(kept);
+    m_transLengths.resize(kept);
+    m_usage.resize(kept);
+    m_shortNameLengths.resize(kept);
+    m_timestamps.resize(kept);
+    m_arena.swap(arena);
+    m_garbage = 0;
+    m_removed = 0;
+}
+
+// Only the timestamp column is written, the names of the item
+// are left in the arena as garbage
+void CatalogColumns::remove(int i) {
+    Q_ASSERT(!isRemoved(i));
+    m_garbage += namesLength(i);
+    m_timestamps[i] = -1;
+    ++m_removed;
+}
+
+void CatalogColumns::rename(int i, const CatItem& item) {
+    m_garbage += namesLength(i);
+    m_shortNameLengths[i] = item.shortName.count();
+    write(item, i);
+
+    if (m_garbage > m_arena.size() / 2) {
+        compact();
+    }
+}
+
+bool CatalogColumns::sameNames(int i, const CatItem& item) const {
+    return lowerName(i) == item.searchName[CatItem::LOWER]
+        && transName(i) == item.searchName[CatItem::TRANS];
+}
+
+void CatalogColumns::fillNames(int i, CatItem& item) const {
+    const QChar* chars = reinterpret_cast<const QChar*>(names(i));
+    item.searchName[CatItem::LOWER] = QString(chars, m_lowerLengths[i]);
+    item.searchName[CatItem::TRANS] = QString(chars + m_lowerLengths[i], m_transLengths[i]);
+}
+
+void CatalogColumns::write(const CatItem& item, int i) {
+    const QString& lower = item.searchName[CatItem::LOWER];
+    const QString& trans = item.searchName[CatItem::TRANS];
+
+    int offset = m_arena.size();
+    m_arena.resize(offset + lower.size() + trans.size());
+
+    ushort* dest = m_arena.data() + offset;
+    std::copy(lower.utf16(), lower.utf16() + lower.size(), dest);
+    std::copy(trans.utf16(), trans.utf16() + trans.size(), dest + lower.size());
+
+    m_offsets[i] = offset;
+    m_lowerLengths[i] = lower.size();
+    m_transLengths[i] = trans.size();
+}
+
+// Copy the live names into a new arena, dropping the space
+// left behind by removed and renamed items
+void CatalogColumns::compact() {
+    QVector<ushort> arena;
+    arena.reserve(m_arena.size() - m_garbage);
+    for (int i = 0; i < count(); ++i) {
+        if (isRemoved(i)) {
+            m_offsets[i] = 0;
+            m_lowerLengths[i] = 0;
+            m_transLengths[i] = 0;
+            continue;
+        }
+        int offset = arena.size();
+        const ushort* src = names(i);
+        arena.resize(offset + namesLength(i));
+        std::copy(src, src + namesLength(i), arena.data() + offset);
+        m_offsets[i] = offset;
+    }
+    m_arena.swap(arena);
+    m_garbage = 0;
+}
+
+qint64 CatalogColumns::memoryUsage() const {
+    return m_arena.capacity() * sizeof(ushort)
+        + (m_offsets.capacity() + m_lowerLengths.capacity() + m_transLengths.capacity()
+           + m_usage.capacity() + m_shortNameLengths.capacity()
+           + m_timestamps.capacity()) * sizeof(int);
+}
+
+}
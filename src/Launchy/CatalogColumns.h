@@ -0,0 +1,151 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include "SubsequenceMatcher.h"
+
+namespace launchy {
+
+class CatItem;
+
+// CatalogColumns holds the per item fields read while searching and ranking
+// as parallel arrays, so a search over the catalog only walks these arrays
+// and never touches the CatItem rows.
+// The search names of all items live in one arena, an item's names are its
+// searchName[LOWER] directly followed by searchName[TRANS], which is the
+// sequence Catalog::matches walks through.
+class CatalogColumns {
+public:
+    CatalogColumns();
+
+    void clear();
+    int count() const;
+    void append(const CatItem& item, int timestamp);
+    // Append packed search names to the arena and return the offset of the
+    // first one, the items using them are then appended by appendItem(),
+    // a catalog image is loaded this way without repacking the names
+    int appendNames(const QVector<ushort>& names);
+    void appendItem(int offset, int lowerLength, int transLength,
+                    int usage, int shortNameLength, int timestamp);
+    // Remove every item i with keep[i] false in a single pass, the
+    // remaining items keep their order and the arena is compacted
+    void retain(const QVector<bool>& keep);
+    // Mark item i removed without moving the items after it, searches
+    // skip it until the next retain() drops it
+    void remove(int i);
+    bool isRemoved(int i) const;
+    int removedCount() const;
+    // Renamed items are written to the end of the arena,
+    // the space they used is reclaimed by the next compaction
+    void rename(int i, const CatItem& item);
+    bool sameNames(int i, const CatItem& item) const;
+    // Copy the search names of item i back into a CatItem
+    void fillNames(int i, CatItem& item) const;
+
+    const ushort* names(int i) const;
+    int namesLength(int i) const;
+    QString lowerName(int i) const;
+    QString transName(int i) const;
+    bool matches(int i, const QString& query) const;
+
+    int usage(int i) const;
+    void setUsage(int i, int usage);
+    int shortNameLength(int i) const;
+    int timestamp(int i) const;
+    void setTimestamp(int i, int timestamp);
+
+    // Approximate heap bytes held by the columns
+    qint64 memoryUsage() const;
+
+private:
+    void write(const CatItem& item, int i);
+    void compact();
+
+private:
+    QVector<ushort> m_arena;
+    int m_garbage;
+    int m_removed;
+
+    QVector<int> m_offsets;
+    QVector<int> m_lowerLengths;
+    QVector<int> m_transLengths;
+    QVector<int> m_usage;
+    QVector<int> m_shortNameLengths;
+    QVector<int> m_timestamps;
+};
+
+inline int CatalogColumns::count() const {
+    return m_offsets.size();
+}
+
+inline const ushort* CatalogColumns::names(int i) const {
+    return m_arena.constData() + m_offsets[i];
+}
+
+inline int CatalogColumns::namesLength(int i) const {
+    return m_lowerLengths[i] + m_transLengths[i];
+}
+
+// The returned strings reference the arena and are only valid
+// until the columns are modified
+inline QString CatalogColumns::lowerName(int i) const {
+    return QString::fromRawData(reinterpret_cast<const QChar*>(names(i)), m_lowerLengths[i]);
+}
+
+inline QString CatalogColumns::transName(int i) const {
+    return QString::fromRawData(reinterpret_cast<const QChar*>(names(i) + m_lowerLengths[i]),
+                                m_transLengths[i]);
+}
+
+inline bool CatalogColumns::matches(int i, const QString& query) const {
+    return SubsequenceMatcher::matches(names(i), namesLength(i), query.utf16(), query.size());
+}
+
+// Removed items have a negative timestamp
+inline bool CatalogColumns::isRemoved(int i) const {
+    return m_timestamps[i] < 0;
+}
+
+inline int CatalogColumns::removedCount() const {
+    return m_removed;
+}
+
+inline int CatalogColumns::usage(int i) const {
+    return m_usage[i];
+}
+
+inline void CatalogColumns::setUsage(int i, int usage) {
+    m_usage[i] = usage;
+}
+
+inline int CatalogColumns::shortNameLength(int i) const {
+    return m_shortNameLengths[i];
+}
+
+inline int CatalogColumns::timestamp(int i) const {
+    return m_timestamps[i];
+}
+
+inline void CatalogColumns::setTimestamp(int i, int timestamp) {
+    m_timestamps[i] = timestamp;
+}
+
+}
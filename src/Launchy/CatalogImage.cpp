@@ -0,0 +1,448 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "CatalogImage.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <QDataStream>
+#include <QHash>
+#include <QSaveFile>
+#include <QtConcurrent>
+#include <QtEndian>
+#include <QDebug>
+
+namespace launchy {
+
+static const char CATALOG_IMAGE_MAGIC[8] = { 'L', 'C', 'A', 'T', 'A', 'L', 'O', 'G' };
+// Bumped whenever the layout of the catalog image changes
+static const quint32 CATALOG_IMAGE_VERSION = 2;
+
+static const qint64 HEADER_SIZE = sizeof(CATALOG_IMAGE_MAGIC) + 4 * sizeof(quint32);
+static const qint64 INDEX_ENTRY_SIZE = sizeof(quint64) + 3 * sizeof(quint32);
+static const qint64 RECORD_SIZE = 9 * sizeof(quint32);
+
+static quint32 readNumber(const uchar* src) {
+    return qFromLittleEndian<quint32>(src);
+}
+
+static qint64 remaining(const QDataStream& in) {
+    return in.device()->size() - in.device()->pos();
+}
+
+static void writeChars(QDataStream& out, const ushort* chars, int count) {
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    out.writeRawData(reinterpret_cast<const char*>(chars), count * sizeof(ushort));
+#else
+    for (int i = 0; i < count; ++i) {
+        out << quint16(chars[i]);
+    }
+#endif
+}
+
+static bool readChars(QDataStream& in, ushort* chars, int count) {
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    int bytes = count * sizeof(ushort);
+    return in.readRawData(reinterpret_cast<char*>(chars), bytes) == bytes;
+#else
+    for (int i = 0; i < count; ++i) {
+        quint16 c;
+        in >> c;
+        chars[i] = c;
+    }
+    return in.status() == QDataStream::Ok;
+#endif
+}
+
+// Records are laid out like the Record struct, which little endian
+// hosts copy in one go
+static_assert(sizeof(CatalogImage::Record) == RECORD_SIZE, "records must have no padding");
+
+static void writeRecords(QDataStream& out, const QVector<CatalogImage::Record>& records) {
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    out.writeRawData(reinterpret_cast<const char*>(records.constData()),
+                     records.size() * RECORD_SIZE);
+#else
+    foreach(const CatalogImage::Record& r, records) {
+        out << r.directory << r.iconPath << r.leaf << r.shortName << r.pluginId
+            << r.usage << r.namesOffset << r.lowerLength << r.transLength;
+    }
+#endif
+}
+
+static bool readRecords(QDataStream& in, CatalogImage::Record* records, int count) {
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    int bytes = count * RECORD_SIZE;
+    return in.readRawData(reinterpret_cast<char*>(records), bytes) == bytes;
+#else
+    for (int i = 0; i < count; ++i) {
+        CatalogImage::Record& r = records[i];
+        in >> r.directory >> r.iconPath >> r.leaf >> r.shortName >> r.pluginId
+            >> r.usage >> r.namesOffset >> r.lowerLength >> r.transLength;
+    }
+    return in.status() == QDataStream::Ok;
+#endif
+}
+
+// A string table is the number of strings and of their characters,
+// the offset of every string followed by the end offset, and the characters
+static void writeStrings(QDataStream& out, const QVector<QString>& strings) {
+    quint32 size = 0;
+    foreach(const QString& str, strings) {
+        size += str.size();
+    }
+    out << quint32(strings.size()) << size;
+
+    quint32 offset = 0;
+    out << offset;
+    foreach(const QString& str, strings) {
+        offset += str.size();
+        out << offset;
+    }
+    foreach(const QString& str, strings) {
+        writeChars(out, str.utf16(), str.size());
+    }
+}
+
+static bool readStrings(QDataStream& in, QVector<QString>& strings) {
+    quint32 count = 0;
+    quint32 size = 0;
+    in >> count >> size;
+    if (in.status() != QDataStream::Ok
+        || (qint64(count) + 1) * sizeof(quint32) + qint64(size) * sizeof(ushort) > remaining(in)) {
+        return false;
+    }
+
+    QVector<quint32> offsets(count + 1);
+    for (quint32 i = 0; i <= count; ++i) {
+        in >> offsets[i];
+        if (offsets[i] > size || (i > 0 && offsets[i] < offsets[i - 1])) {
+            return false;
+        }
+    }
+    if (offsets[0] != 0 || offsets[count] != size) {
+        return false;
+    }
+
+    QVector<ushort> chars(size);
+    if (!readChars(in, chars.data(), size)) {
+        return false;
+    }
+    strings.resize(count);
+    for (quint32 i = 0; i < count; ++i) {
+        strings[i] = QString(reinterpret_cast<const QChar*>(chars.constData() + offsets[i]),
+                             offsets[i + 1] - offsets[i]);
+    }
+    return true;
+}
+
+
+CatalogImage::CatalogImage()
+    : m_data(nullptr),
+      m_size(0),
+      m_count(0) {
+
+}
+
+CatalogImage::~CatalogImage() {
+    close();
+}
+
+bool CatalogImage::open(const QString& filename) {
+    close();
+
+    m_file.setFileName(filename);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    m_size = m_file.size();
+    if (m_size < HEADER_SIZE) {
+        close();
+        return false;
+    }
+    m_data = m_file.map(0, m_size);
+    if (!m_data) {
+        qWarning() << "CatalogImage::open, fail to map catalog file:" << filename;
+        close();
+        return false;
+    }
+
+    if (memcmp(m_data, CATALOG_IMAGE_MAGIC, sizeof(CATALOG_IMAGE_MAGIC)) != 0) {
+        close();
+        return false;
+    }
+
+    const uchar* header = m_data + sizeof(CATALOG_IMAGE_MAGIC);
+    quint32 version = readNumber(header);
+    if (version != CATALOG_IMAGE_VERSION) {
+        qWarning() << "CatalogImage::open, unknown catalog version:" << version;
+        close();
+        return false;
+    }
+    m_count = readNumber(header + 4);
+    quint32 poolCount = readNumber(header + 8);
+    quint32 blockCount = readNumber(header + 12);
+
+    // Every offset is checked once, so that reading a block never leaves the mapped file
+    qint64 blocks = HEADER_SIZE + qint64(blockCount) * INDEX_ENTRY_SIZE;
+    bool valid = m_count <= INT_MAX && blockCount > 0 && blocks <= m_size;
+    qint64 items = 0;
+    for (quint32 i = 0; valid && i < blockCount; ++i) {
+        const uchar* src = m_data + HEADER_SIZE + i * INDEX_ENTRY_SIZE;
+        IndexEntry entry;
+        entry.offset = qFromLittleEndian<quint64>(src);
+        entry.size = readNumber(src + 8);
+        entry.count = readNumber(src + 12);
+        entry.checksum = readNumber(src + 16);
+        valid = entry.offset >= blocks && entry.offset <= m_size
+            && entry.size <= m_size - entry.offset;
+        items += i > 0 ? entry.count : 0;
+        m_index.push_back(entry);
+    }
+
+    // The pool is needed by every item block, without it the whole catalog is lost
+    if (valid && items == m_count && m_index[0].count == poolCount) {
+        QByteArray data = uncompress(m_index[0]);
+        QDataStream in(data);
+        in.setByteOrder(QDataStream::LittleEndian);
+        valid = readStrings(in, m_pool) && quint32(m_pool.size()) == poolCount
+            && !m_pool.isEmpty() && m_pool[0].isEmpty();
+    }
+    else {
+        valid = false;
+    }
+
+    if (!valid) {
+        qWarning() << "CatalogImage::open, catalog file is damaged:" << filename;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void CatalogImage::close() {
+    if (m_data) {
+        m_file.unmap(const_cast<uchar*>(m_data));
+        m_data = nullptr;
+    }
+    m_file.close();
+    m_size = 0;
+    m_count = 0;
+    m_index.clear();
+    m_pool.clear();
+}
+
+QVector<CatalogImage::Block> CatalogImage::readBlocks(int first, int count) const {
+    QVector<Block> blocks(qBound(0, count, blockCount() - first));
+    for (int i = 0; i < blocks.size(); ++i) {
+        blocks[i].index = first + i;
+        blocks[i].valid = false;
+    }
+
+    QtConcurrent::blockingMap(blocks, [this](Block& block) {
+        decodeBlock(block);
+    });
+
+    foreach(const Block& block, blocks) {
+        if (!block.valid) {
+            qWarning() << "CatalogImage::readBlocks, skipped damaged block" << block.index
+                << "of" << m_index[block.index + 1].count << "items";
+        }
+    }
+    return blocks;
+}
+
+// The checksum covers the compressed data, so a damaged block
+// is found before it is decompressed
+QByteArray CatalogImage::uncompress(const IndexEntry& entry) const {
+    QByteArray compressed = QByteArray::fromRawData(
+        reinterpret_cast<const char*>(m_data + entry.offset), entry.size);
+    if (qChecksum(compressed.constData(), compressed.size()) != entry.checksum) {
+        return QByteArray();
+    }
+    return qUncompress(compressed);
+}
+
+void CatalogImage::decodeBlock(Block& block) const {
+    const IndexEntry& entry = m_index[block.index + 1];
+    QByteArray data = uncompress(entry);
+    QDataStream in(data);
+    in.setByteOrder(QDataStream::LittleEndian);
+
+    QVector<QString> strings;
+    quint32 count = 0;
+    quint32 namesSize = 0;
+    if (!readStrings(in, strings)) {
+        return;
+    }
+    in >> count >> namesSize;
+    if (in.status() != QDataStream::Ok || count != entry.count
+        || qint64(count) * RECORD_SIZE + qint64(namesSize) * sizeof(ushort) > remaining(in)) {
+        return;
+    }
+
+    QVector<Record> records(count);
+    if (!readRecords(in, records.data(), count)) {
+        return;
+    }
+    for (const Record& r : records) {
+        if (r.directory >= quint32(m_pool.size()) || r.iconPath >= quint32(m_pool.size())
+            || r.leaf >= quint32(strings.size()) || r.shortName >= quint32(strings.size())
+            || r.namesOffset > namesSize
+            || r.lowerLength > namesSize - r.namesOffset
+            || r.transLength > namesSize - r.namesOffset - r.lowerLength) {
+            return;
+        }
+    }
+
+    QVector<ushort> names(namesSize);
+    if (!readChars(in, names.data(), namesSize)) {
+        return;
+    }
+
+    // Leaf and short names shared by several items are shared in memory too
+    block.rows.resize(count);
+    for (quint32 i = 0; i < count; ++i) {
+        const Record& r = records[i];
+        CatalogItem& row = block.rows[i];
+        row.shortName = strings[r.shortName];
+        row.leaf = strings[r.leaf];
+        row.pluginId = r.pluginId;
+        row.directory = r.directory;
+        row.iconPath = r.iconPath;
+    }
+    block.records.swap(records);
+    block.names.swap(names);
+    block.valid = true;
+}
+
+bool CatalogImage::isImage(const QString& filename) {
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QByteArray magic = file.read(sizeof(CATALOG_IMAGE_MAGIC));
+    return magic == QByteArray::fromRawData(CATALOG_IMAGE_MAGIC, sizeof(CATALOG_IMAGE_MAGIC));
+}
+
+bool CatalogImage::write(const QString& filename, const CatalogSnapshot& snapshot) {
+    const QVector<CatalogItem>& items = snapshot.m_items;
+    const CatalogColumns& columns = snapshot.m_columns;
+
+    QVector<QByteArray> blocks;
+    QVector<quint32> counts;
+    {
+        QByteArray data;
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out.setByteOrder(QDataStream::LittleEndian);
+        writeStrings(out, snapshot.m_strings);
+        blocks.push_back(qCompress(data));
+        counts.push_back(snapshot.m_strings.size());
+    }
+
+    // Rows removed since the catalog last dropped them are left out
+    QVector<int> live;
+    live.reserve(items.size() - columns.removedCount());
+    for (int i = 0; i < items.size(); ++i) {
+        if (!columns.isRemoved(i)) {
+            live.push_back(i);
+        }
+    }
+
+    for (int first = 0; first < live.size(); first += BlockItems) {
+        int last = qMin(first + int(BlockItems), live.size());
+
+        // The leaf and short names of the block, each of them once
+        QVector<QString> strings;
+        QHash<QString, quint32> indices;
+        auto indexOf = [&](const QString& str) {
+            auto it = indices.constFind(str);
+            if (it != indices.constEnd()) {
+                return it.value();
+            }
+            quint32 index = strings.size();
+            strings.push_back(str);
+            indices.insert(str, index);
+            return index;
+        };
+
+        // The names are written compacted, in item order
+        QVector<Record> records(last - first);
+        QVector<ushort> names;
+        for (int k = first; k < last; ++k) {
+            int i = live[k];
+            const CatalogItem& row = items[i];
+            Record& r = records[k - first];
+            r.directory = row.directory;
+            r.iconPath = row.iconPath;
+            r.leaf = indexOf(row.leaf);
+            r.shortName = indexOf(row.shortName);
+            r.pluginId = row.pluginId;
+            r.usage = columns.usage(i);
+            r.namesOffset = names.size();
+            r.lowerLength = columns.lowerName(i).size();
+            r.transLength = columns.transName(i).size();
+            const ushort* src = columns.names(i);
+            names.resize(names.size() + columns.namesLength(i));
+            std::copy(src, src + columns.namesLength(i), names.data() + r.namesOffset);
+        }
+
+        QByteArray data;
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out.setByteOrder(QDataStream::LittleEndian);
+        writeStrings(out, strings);
+        out << quint32(records.size()) << quint32(names.size());
+        writeRecords(out, records);
+        writeChars(out, names.constData(), names.size());
+        blocks.push_back(qCompress(data));
+        counts.push_back(records.size());
+    }
+
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning("CatalogImage::write, Could not open catalog file for writing");
+        return false;
+    }
+
+    QDataStream out(&file);
+    out.setByteOrder(QDataStream::LittleEndian);
+    out.writeRawData(CATALOG_IMAGE_MAGIC, sizeof(CATALOG_IMAGE_MAGIC));
+    out << CATALOG_IMAGE_VERSION << quint32(live.size()) << quint32(snapshot.m_strings.size())
+        << quint32(blocks.size());
+
+    quint64 offset = HEADER_SIZE + blocks.size() * INDEX_ENTRY_SIZE;
+    for (int i = 0; i < blocks.size(); ++i) {
+        const QByteArray& block = blocks[i];
+        out << offset << quint32(block.size()) << counts[i]
+            << quint32(qChecksum(block.constData(), block.size()));
+        offset += block.size();
+    }
+    foreach(const QByteArray& block, blocks) {
+        out.writeRawData(block.constData(), block.size());
+    }
+
+    if (out.status() != QDataStream::Ok || !file.commit()) {
+        qWarning() << "CatalogImage::write, fail to write catalog file:" << filename;
+        return false;
+    }
+    return true;
+}
+
+}
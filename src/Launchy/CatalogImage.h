@@ -0,0 +1,125 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+#include "CatalogSnapshot.h"
+
+namespace launchy {
+
+// CatalogImage is the binary catalog file, a header and an index followed
+// by blocks compressed independently of each other:
+//   header  magic, version, item count, pool size and block count
+//   index   offset, size, item count and checksum of every block
+//   blocks  the StringPool of the catalog first, then the items in
+//           blocks of up to BlockItems items
+// An item block holds the leaf and short names of its items, one fixed size
+// Record per item and the packed search names in the CatalogColumns layout.
+// The file is mapped, the blocks are decompressed and decoded in parallel
+// and a damaged block only loses its own items.
+// Numbers are little endian.
+class CatalogImage {
+public:
+    enum {
+        BlockItems = 4096
+    };
+
+    struct Record {
+        // Handles into the pool strings
+        quint32 directory;
+        quint32 iconPath;
+        // Indices of the block strings
+        quint32 leaf;
+        quint32 shortName;
+        quint32 pluginId;
+        qint32 usage;
+        // Search names, in characters into the block names
+        quint32 namesOffset;
+        quint32 lowerLength;
+        quint32 transLength;
+    };
+
+    // A decoded block of items
+    struct Block {
+        int index;
+        bool valid;
+        QVector<CatalogItem> rows;
+        QVector<Record> records;
+        QVector<ushort> names;
+    };
+
+    CatalogImage();
+    ~CatalogImage();
+
+    // Map a catalog image and read its index and string pool, return false
+    // if the file is missing, written in another format or damaged
+    bool open(const QString& filename);
+    void close();
+
+    int count() const;
+    int blockCount() const;
+    const QVector<QString>& pool() const;
+    // Decode count item blocks from first on the thread pool,
+    // damaged blocks are returned invalid and empty
+    QVector<Block> readBlocks(int first, int count) const;
+
+    // Return true if the file starts like a catalog image of any version
+    static bool isImage(const QString& filename);
+    // Write the contents of a snapshot as a catalog image
+    static bool write(const QString& filename, const CatalogSnapshot& snapshot);
+
+private:
+    struct IndexEntry {
+        qint64 offset;
+        quint32 size;
+        quint32 count;
+        quint32 checksum;
+    };
+
+    QByteArray uncompress(const IndexEntry& entry) const;
+    void decodeBlock(Block& block) const;
+
+private:
+    QFile m_file;
+    const uchar* m_data;
+    qint64 m_size;
+    quint32 m_count;
+    QVector<IndexEntry> m_index;
+    QVector<QString> m_pool;
+};
+
+inline int CatalogImage::count() const {
+    return m_count;
+}
+
+// Item blocks, the pool block is not counted
+inline int CatalogImage::blockCount() const {
+    return qMax(0, m_index.size() - 1);
+}
+
+inline const QVector<QString>& CatalogImage::pool() const {
+    return m_pool;
+}
+
+}
+
+Q_DECLARE_TYPEINFO(launchy::CatalogImage::Record, Q_PRIMITIVE_TYPE);
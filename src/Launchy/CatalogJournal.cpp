@@ -0,0 +1,186 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "CatalogJournal.h"
+#include <QDataStream>
+#include <QDebug>
+
+namespace launchy {
+
+// Bumped whenever the layout of the journal entries changes
+static const quint32 JOURNAL_VERSION = 1;
+
+CatalogJournal::CatalogJournal() {
+
+}
+
+CatalogJournal::~CatalogJournal() {
+    close();
+}
+
+bool CatalogJournal::open(const QString& catalogFilename) {
+    close();
+
+    m_catalogFilename = catalogFilename;
+    m_file.setFileName(journalFilename(catalogFilename));
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "CatalogJournal::open, fail to open journal file:" << m_file.fileName();
+        return false;
+    }
+
+    if (m_file.size() == 0) {
+        QDataStream out(&m_file);
+        out.setVersion(QDataStream::Qt_5_0);
+        out << JOURNAL_VERSION;
+    }
+    return true;
+}
+
+void CatalogJournal::close() {
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+// An entry is its length, the checksum of its data and the data,
+// a write cut short by a crash fails the checks while reading
+void CatalogJournal::append(Operation operation, const CatItem& item) {
+    if (!isOpen()) {
+        return;
+    }
+
+    QByteArray data;
+    QDataStream entry(&data, QIODevice::WriteOnly);
+    entry.setVersion(QDataStream::Qt_5_0);
+    entry << quint8(operation) << item;
+
+    QDataStream out(&m_file);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << quint32(data.size()) << qChecksum(data.constData(), data.size());
+    out.writeRawData(data.constData(), data.size());
+}
+
+void CatalogJournal::flush() {
+    if (isOpen()) {
+        m_file.flush();
+    }
+}
+
+bool CatalogJournal::rotate() {
+    if (!isOpen()) {
+        return false;
+    }
+    m_file.close();
+
+    QString journal = journalFilename(m_catalogFilename);
+    QString rotated = rotatedFilename(m_catalogFilename);
+    bool rotatedOk = false;
+    if (!QFile::exists(rotated)) {
+        rotatedOk = QFile::rename(journal, rotated);
+    }
+    else {
+        // The last image could not be written, its entries stay in front
+        QFile in(journal);
+        QFile out(rotated);
+        if (in.open(QIODevice::ReadOnly) && out.open(QIODevice::WriteOnly | QIODevice::Append)
+            && in.seek(sizeof(JOURNAL_VERSION))) {
+            rotatedOk = out.write(in.readAll()) >= 0;
+        }
+        in.close();
+        rotatedOk = rotatedOk && QFile::remove(journal);
+    }
+
+    if (!rotatedOk) {
+        // The entries stay in the journal, replaying them again is harmless
+        qWarning() << "CatalogJournal::rotate, fail to rotate journal file:" << journal;
+    }
+    return open(m_catalogFilename) && rotatedOk;
+}
+
+void CatalogJournal::discardRotated(const QString& catalogFilename) {
+    QFile::remove(rotatedFilename(catalogFilename));
+}
+
+QVector<CatalogJournal::Entry> CatalogJournal::read(const QString& catalogFilename) {
+    QVector<Entry> entries;
+    readFile(rotatedFilename(catalogFilename), entries);
+    readFile(journalFilename(catalogFilename), entries);
+    return entries;
+}
+
+QString CatalogJournal::journalFilename(const QString& catalogFilename) {
+    return catalogFilename + ".journal";
+}
+
+QString CatalogJournal::rotatedFilename(const QString& catalogFilename) {
+    return catalogFilename + ".journal.old";
+}
+
+bool CatalogJournal::readFile(const QString& filename, QVector<Entry>& entries) {
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QByteArray ba = file.readAll();
+    if (ba.isEmpty()) {
+        return true;
+    }
+    QDataStream in(ba);
+    in.setVersion(QDataStream::Qt_5_0);
+
+    quint32 version = 0;
+    in >> version;
+    if (version != JOURNAL_VERSION) {
+        qWarning() << "CatalogJournal::read, unknown journal version:" << version;
+        return false;
+    }
+
+    while (!in.atEnd()) {
+        quint32 length = 0;
+        quint16 checksum = 0;
+        in >> length >> checksum;
+        if (in.status() != QDataStream::Ok || length > ba.size() - in.device()->pos()) {
+            qWarning() << "CatalogJournal::read, journal file is truncated:" << filename;
+            return false;
+        }
+
+        QByteArray data(length, Qt::Uninitialized);
+        in.readRawData(data.data(), length);
+        if (qChecksum(data.constData(), length) != checksum) {
+            qWarning() << "CatalogJournal::read, journal file is damaged:" << filename;
+            return false;
+        }
+
+        QDataStream entry(data);
+        entry.setVersion(QDataStream::Qt_5_0);
+        quint8 operation = 0;
+        Entry e;
+        entry >> operation >> e.item;
+        if (entry.status() != QDataStream::Ok || operation < AddItem || operation > SetUsage) {
+            qWarning() << "CatalogJournal::read, unknown journal entry in:" << filename;
+            return false;
+        }
+        e.operation = Operation(operation);
+        entries.push_back(e);
+    }
+    return true;
+}
+
+}
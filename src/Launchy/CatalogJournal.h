@@ -0,0 +1,85 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+#include "CatalogItem.h"
+
+namespace launchy {
+
+// CatalogJournal is the write ahead log of the catalog. The changes made
+// since the catalog image was written are appended to it as they happen and
+// replayed over the image by the next load. An entry holds the whole new
+// state of an item, so replaying an entry more than once does no harm.
+// Writing a new image rotates the journal first, the entries it covers wait
+// in the rotated file until the image is written and then are discarded.
+class CatalogJournal {
+public:
+    enum Operation {
+        AddItem = 1,
+        RemoveItem = 2,
+        SetUsage = 3
+    };
+
+    struct Entry {
+        Operation operation;
+        // Only the full path and short name of removed items are
+        // meaningful, and only the usage besides them for usage changes
+        CatItem item;
+    };
+
+    CatalogJournal();
+    ~CatalogJournal();
+
+    // Start appending to the journal of a catalog file
+    bool open(const QString& catalogFilename);
+    void close();
+    bool isOpen() const;
+
+    void append(Operation operation, const CatItem& item);
+    // Hand the appended entries to the system,
+    // from then on they survive a crash of launchy
+    void flush();
+    // Move the entries to the rotated file and start an empty journal
+    bool rotate();
+    // Drop the rotated entries once the image holding them is written
+    static void discardRotated(const QString& catalogFilename);
+
+    // Return the entries of the rotated and current journals of a catalog
+    // file in the order they were appended, a torn last entry is skipped
+    static QVector<Entry> read(const QString& catalogFilename);
+
+private:
+    static QString journalFilename(const QString& catalogFilename);
+    static QString rotatedFilename(const QString& catalogFilename);
+    static bool readFile(const QString& filename, QVector<Entry>& entries);
+
+private:
+    QString m_catalogFilename;
+    QFile m_file;
+};
+
+inline bool CatalogJournal::isOpen() const {
+    return m_file.isOpen();
+}
+
+}
@@ -0,0 +1,531 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CatalogSnapshot.h"
+#include <algorithm>
+#include <iterator>
+#include <QtConcurrent>
+#include "Catalog.h"
+#include "FuzzyPattern.h"
+#include "GlobalVar.h"
+#include "OptionItem.h"
+#include "SearchControl.h"
+#include "SettingsSnapshot.h"
+
+namespace launchy {
+
+CatalogItem::CatalogItem()
+    : data(nullptr),
+      pluginId(0),
+      directory(0),
+      iconPath(0) {
+
+}
+
+CatalogItem::CatalogItem(const CatItem& item, StringPool& strings)
+    : shortName(item.shortName),
+      data(item.data),
+      pluginId(item.pluginId),
+      iconPath(strings.intern(item.iconPath)) {
+    int split = splitPosition(item.fullPath);
+    directory = strings.intern(item.fullPath.left(split));
+    leaf = item.fullPath.mid(split);
+}
+
+bool CatalogItem::hasFullPath(const QString& fullPath, const QVector<QString>& strings) const {
+    const QString& dir = strings[directory];
+    return fullPath.size() == dir.size() + leaf.size()
+        && fullPath.startsWith(dir)
+        && fullPath.midRef(dir.size()) == leaf;
+}
+
+void CatalogItem::fill(CatItem& item, const QVector<QString>& strings) const {
+    item.fullPath = fullPath(strings);
+    item.shortName = shortName;
+    item.iconPath = strings[iconPath];
+    item.data = data;
+    item.pluginId = pluginId;
+}
+
+qint64 CatalogItem::memoryUsage() const {
+    qint64 bytes = sizeof(CatalogItem) + stringMemoryUsage(leaf);
+    // Short names are often shared with the identity hash, not with the leaf
+    return bytes + stringMemoryUsage(shortName);
+}
+
+int CatalogItem::splitPosition(const QString& fullPath) {
+    int slash = qMax(fullPath.lastIndexOf('/'), fullPath.lastIndexOf('\\'));
+    return slash + 1;
+}
+
+
+CatalogSnapshot::CatalogSnapshot() {
+    m_strings.push_back(QString());
+}
+
+CatalogSnapshot::CatalogSnapshot(const QVector<CatalogItem>& items, const CatalogColumns& columns,
+                                 const QVector<QString>& strings)
+    : m_items(items),
+      m_columns(columns),
+      m_strings(strings) {
+
+}
+
+CatalogSnapshot::~CatalogSnapshot() {
+
+}
+
+CatItem CatalogSnapshot::item(int i) const {
+    CatItem result;
+    m_items[i].fill(result, m_strings);
+    m_columns.fillNames(i, result);
+    result.usage = m_columns.usage(i);
+    return result;
+}
+
+bool CatalogSnapshot::isSameItem(int i, const QString& shortName, const QString& fullPath) const {
+    return m_items[i].shortName == shortName && m_items[i].hasFullPath(fullPath, m_strings);
+}
+
+QVector<int> CatalogSnapshot::search(const QString& searchText,
+                                     const QVector<int>* candidates,
+                                     const SearchControl* control) const {
+    QVector<int> result;
+    if (!searchText.isEmpty()) {
+        QString lowSearch = searchText.toLower();
+        FuzzyPattern fuzzy(lowSearch, fuzzyEdits(lowSearch));
+        const FuzzyPattern* tolerant = fuzzy.maxEdits() > 0 ? &fuzzy : nullptr;
+        if (candidates) {
+            result = filterMatches(candidates->constData(), candidates->count(),
+                                   lowSearch, tolerant, control);
+        }
+        else {
+            result = filterMatches(nullptr, m_items.count(), lowSearch, tolerant, control);
+        }
+    }
+
+    return result;
+}
+
+int CatalogSnapshot::fuzzyEdits(const QString& lowSearch) {
+    return FuzzyPattern::editsFor(lowSearch, SettingsSnapshot::current()->catalogFuzzyEdits);
+}
+
+// Smallest shard worth handing to another thread
+static const int MIN_SHARD_SIZE = 4096;
+// A search checks whether it should stop once per 1024 items
+static const int CONTROL_POLL_MASK = 1023;
+
+// Number of shards a search over count items is split into
+static int shardCount(int count) {
+    int threshold = SettingsSnapshot::current()->catalogParallelThreshold;
+    if (threshold <= 0 || count < threshold) {
+        return 1;
+    }
+    return qBound(1, QThread::idealThreadCount(), count / MIN_SHARD_SIZE);
+}
+
+QVector<int> CatalogSnapshot::filterMatches(const int* indices, int count,
+                                            const QString& lowSearch,
+                                            const FuzzyPattern* fuzzy,
+                                            const SearchControl* control) const {
+    int shards = shardCount(count);
+    if (shards == 1) {
+        return filterShard(indices, 0, count, lowSearch, fuzzy, control);
+    }
+
+    // The calling thread checks the last shard itself
+    QList<QFuture<QVector<int>>> futures;
+    for (int shard = 0; shard < shards - 1; ++shard) {
+        int begin = (qint64)count * shard / shards;
+        int end = (qint64)count * (shard + 1) / shards;
+        futures.push_back(QtConcurrent::run([=]() {
+            return filterShard(indices, begin, end, lowSearch, fuzzy, control);
+        }));
+    }
+    QVector<int> last = filterShard(indices, (qint64)count * (shards - 1) / shards,
+                                    count, lowSearch, fuzzy, control);
+
+    QVector<int> result;
+    foreach(QFuture<QVector<int>> future, futures) {
+        result += future.result();
+    }
+    result += last;
+    return result;
+}
+
+QVector<int> CatalogSnapshot::filterShard(const int* indices, int begin, int end,
+                                          const QString& lowSearch,
+                                          const FuzzyPattern* fuzzy,
+                                          const SearchControl* control) const {
+    QVector<int> result;
+    for (int k = begin; k < end; ++k) {
+        // Poll the control every few items only
+        if (control && (k & CONTROL_POLL_MASK) == 0 && control->shouldStop()) {
+            break;
+        }
+        int i = indices ? indices[k] : k;
+        if (matchesAt(i, lowSearch, fuzzy)) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+QVector<int> CatalogSnapshot::searchPrefix(const QString& lowSearch,
+                                           const SearchControl* control) const {
+    if (lowSearch.isEmpty()) {
+        return QVector<int>();
+    }
+    return filterPrefix(nullptr, m_items.count(), lowSearch, control);
+}
+
+QVector<int> CatalogSnapshot::filterPrefix(const int* indices, int count,
+                                           const QString& lowSearch,
+                                           const SearchControl* control) const {
+    // A plain comparison of the name starts, cheap enough for one thread
+    QVector<int> result;
+    for (int k = 0; k < count; ++k) {
+        if (control && (k & CONTROL_POLL_MASK) == 0 && control->shouldStop()) {
+            break;
+        }
+        int i = indices ? indices[k] : k;
+        if (m_columns.isRemoved(i)) {
+            continue;
+        }
+        if (m_columns.lowerName(i).startsWith(lowSearch)
+            || m_columns.transName(i).startsWith(lowSearch)) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+bool CatalogSnapshot::matchesAt(int i, const QString& lowSearch,
+                                const FuzzyPattern* fuzzy) const {
+    if (m_columns.isRemoved(i)) {
+        return false;
+    }
+    bool matched = m_columns.matches(i, lowSearch);
+    if (!matched && fuzzy) {
+        matched = fuzzy->matches(m_columns.names(i), m_columns.namesLength(i));
+    }
+    return matched;
+}
+
+// A rank key packs everything CatLessPtr compares, except the absolute
+// tiebreaker, into one integer so that a smaller key is a better match.
+// From the most to the least significant bit the fields are
+//   single character query: demoted, typos, not exact, not at start, usage,
+//                           not found, find position, name length
+//   longer query:           demoted, typos, not exact, not found, usage,
+//                           find position, name length
+// Typos are only counted by fuzzy searches and rank a fuzzy match below
+// every exact subsequence match, they are saturated to 2 bits.
+// Usage is saturated to 24 bits, find position and name length to 16 bits.
+static const int RANK_TYPO_BITS = 2;
+static const int RANK_USAGE_BITS = 24;
+static const int RANK_LENGTH_BITS = 16;
+
+static inline quint64 rankUsage(int usage) {
+    const qint64 bias = Q_INT64_C(1) << (RANK_USAGE_BITS - 1);
+    qint64 biased = qBound(Q_INT64_C(0), usage + bias, 2 * bias - 1);
+    // Higher usage ranks first
+    return (quint64)(2 * bias - 1 - biased);
+}
+
+static inline quint64 rankLength(int length) {
+    return (quint64)qMin(length, (1 << RANK_LENGTH_BITS) - 1);
+}
+
+static inline quint64 rankTypos(const CatalogColumns& columns, int i, const QString& text,
+                               const FuzzyPattern* fuzzy) {
+    if (!fuzzy || columns.matches(i, text)) {
+        return 0;
+    }
+    int typos = fuzzy->distance(columns.names(i), columns.namesLength(i));
+    return (quint64)qMin(typos, (1 << RANK_TYPO_BITS) - 1);
+}
+
+template <bool SingleChar>
+static quint64 rankKey(const CatalogColumns& columns, int i, const QString& text,
+                       const FuzzyPattern* fuzzy) {
+    QString lower = columns.lowerName(i);
+    QString trans = columns.transName(i);
+    int usage = columns.usage(i);
+    bool exact = lower == text || trans == text;
+    int find = std::min(lower.indexOf(text), trans.indexOf(text));
+
+    quint64 key = usage < 0 ? 1 : 0;
+    key = (key << RANK_TYPO_BITS) | rankTypos(columns, i, text, fuzzy);
+    key = (key << 1) | (exact ? 0 : 1);
+    if (SingleChar) {
+        key = (key << 1) | (find == 0 ? 0 : 1);
+        key = (key << RANK_USAGE_BITS) | rankUsage(usage);
+        key = (key << 1) | (find != -1 ? 0 : 1);
+    }
+    else {
+        key = (key << 1) | (find != -1 ? 0 : 1);
+        key = (key << RANK_USAGE_BITS) | rankUsage(usage);
+    }
+    key = (key << RANK_LENGTH_BITS) | rankLength(find != -1 ? find : 0);
+    key = (key << RANK_LENGTH_BITS) | rankLength(columns.shortNameLength(i));
+    return key;
+}
+
+struct RankedMatch {
+    quint64 key;
+    int index;
+};
+
+class RankLess {
+public:
+    RankLess(const QVector<CatalogItem>& rows, const QVector<QString>& strings)
+        : m_rows(rows),
+          m_strings(strings) {
+    }
+
+    bool operator()(const RankedMatch& a, const RankedMatch& b) const {
+        if (a.key != b.key)
+            return a.key < b.key;
+        // Absolute tiebreaker to prevent loops
+        const CatalogItem& rowA = m_rows[a.index];
+        const CatalogItem& rowB = m_rows[b.index];
+        if (rowA.directory == rowB.directory)
+            return rowA.leaf < rowB.leaf;
+        return rowA.fullPath(m_strings) < rowB.fullPath(m_strings);
+    }
+
+private:
+    const QVector<CatalogItem>& m_rows;
+    const QVector<QString>& m_strings;
+};
+
+// Compute the keys of the matches in ranked[begin, end) and put the best
+// top of them in order at the front of the range
+template <bool SingleChar>
+static void rankShard(const CatalogColumns& columns, const RankLess& less,
+                      const QString& text, const FuzzyPattern* fuzzy,
+                      QVector<RankedMatch>& ranked, int begin, int end, int top) {
+    // Compute every key once, the comparisons only read the keys
+    for (int i = begin; i < end; ++i) {
+        ranked[i].key = rankKey<SingleChar>(columns, ranked[i].index, text, fuzzy);
+    }
+    std::partial_sort(ranked.begin() + begin, ranked.begin() + qMin(begin + top, end),
+                      ranked.begin() + end, less);
+}
+
+// Merge the ordered fronts of the shards into the best top matches,
+// followed by every other match in no particular order
+static QVector<RankedMatch> mergeShards(const QVector<RankedMatch>& ranked,
+                                        const QVector<int>& bounds, int top,
+                                        const RankLess& less) {
+    struct Cursor {
+        int pos;
+        int sortedEnd;
+        int end;
+    };
+    QVector<Cursor> cursors;
+    for (int shard = 0; shard + 1 < bounds.count(); ++shard) {
+        Cursor cursor = { bounds[shard], qMin(bounds[shard] + top, bounds[shard + 1]),
+                          bounds[shard + 1] };
+        cursors.push_back(cursor);
+    }
+
+    // Min heap over the next sorted match of every shard
+    auto heapLess = [&](int a, int b) {
+        return less(ranked[cursors[b].pos], ranked[cursors[a].pos]);
+    };
+    QVector<int> heap;
+    for (int shard = 0; shard < cursors.count(); ++shard) {
+        if (cursors[shard].pos < cursors[shard].sortedEnd) {
+            heap.push_back(shard);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), heapLess);
+
+    QVector<RankedMatch> merged;
+    merged.reserve(ranked.count());
+    while (merged.count() < top && !heap.isEmpty()) {
+        std::pop_heap(heap.begin(), heap.end(), heapLess);
+        Cursor& cursor = cursors[heap.last()];
+        merged.push_back(ranked[cursor.pos++]);
+        if (cursor.pos < cursor.sortedEnd) {
+            std::push_heap(heap.begin(), heap.end(), heapLess);
+        }
+        else {
+            heap.pop_back();
+        }
+    }
+
+    foreach(const Cursor& cursor, cursors) {
+        for (int i = cursor.pos; i < cursor.end; ++i) {
+            merged.push_back(ranked[i]);
+        }
+    }
+    return merged;
+}
+
+template <bool SingleChar>
+static void rankMatches(const CatalogColumns& columns, const RankLess& less,
+                        QVector<int>& matches, int first, int last, const QString& text,
+                        const FuzzyPattern* fuzzy) {
+    QVector<RankedMatch> ranked(matches.count() - first);
+    for (int i = first; i < matches.count(); ++i) {
+        ranked[i - first].index = matches[i];
+    }
+
+    // Every shard ranks its own best matches, which are then merged
+    int top = last - first;
+    int shards = shardCount(ranked.count());
+    if (shards == 1) {
+        rankShard<SingleChar>(columns, less, text, fuzzy, ranked, 0, ranked.count(), top);
+    }
+    else {
+        QVector<int> bounds;
+        for (int shard = 0; shard <= shards; ++shard) {
+            bounds.push_back((qint64)ranked.count() * shard / shards);
+        }
+
+        QList<QFuture<void>> futures;
+        for (int shard = 0; shard < shards - 1; ++shard) {
+            futures.push_back(QtConcurrent::run([&, shard]() {
+                rankShard<SingleChar>(columns, less, text, fuzzy, ranked,
+                                      bounds[shard], bounds[shard + 1], top);
+            }));
+        }
+        rankShard<SingleChar>(columns, less, text, fuzzy, ranked,
+                              bounds[shards - 1], bounds[shards], top);
+        foreach(QFuture<void> future, futures) {
+            future.waitForFinished();
+        }
+
+        ranked = mergeShards(ranked, bounds, top, less);
+    }
+
+    for (int i = first; i < matches.count(); ++i) {
+        matches[i] = ranked[i - first].index;
+    }
+}
+
+void CatalogSnapshot::sortMatches(QVector<int>& matches, int first, int last,
+                                  const QString& searchText) const {
+    if (first >= last) {
+        return;
+    }
+
+    FuzzyPattern fuzzy(searchText, fuzzyEdits(searchText));
+    const FuzzyPattern* tolerant = fuzzy.maxEdits() > 0 ? &fuzzy : nullptr;
+
+    if (searchText.count() == 1) {
+        rankMatches<true>(m_columns, RankLess(m_items, m_strings), matches, first, last, searchText, tolerant);
+    }
+    else {
+        rankMatches<false>(m_columns, RankLess(m_items, m_strings), matches, first, last, searchText, tolerant);
+    }
+
+#ifndef QT_NO_DEBUG
+    // The rank keys must order the results the way CatLessPtr does,
+    // which knows nothing about typos
+    if (!tolerant) {
+        for (int i = first + 1; i < last; ++i) {
+            CatItem a = item(matches[i - 1]);
+            CatItem b = item(matches[i]);
+            Q_ASSERT(!CatLess(&b, &a, searchText));
+        }
+    }
+#endif
+}
+
+
+FastCatalogSnapshot::FastCatalogSnapshot(const QVector<CatalogItem>& items,
+                                         const CatalogColumns& columns,
+                                         const QVector<QString>& strings,
+                                         const QHash<ushort, QVector<int>>& postings)
+    : CatalogSnapshot(items, columns, strings),
+      m_postings(postings) {
+
+}
+
+QVector<int> FastCatalogSnapshot::search(const QString& searchText,
+                                        const QVector<int>* candidates,
+                                        const SearchControl* control) const {
+    // The previous matches are already narrower than any posting list,
+    // and a fuzzy match may lack some of the query characters
+    if (candidates || fuzzyEdits(searchText.toLower()) > 0) {
+        return CatalogSnapshot::search(searchText, candidates, control);
+    }
+
+    QVector<int> result;
+    if (searchText.isEmpty()) {
+        return result;
+    }
+
+    QString lowSearch = searchText.toLower();
+
+    // Every character of a subsequence match has to appear somewhere in the
+    // search names, so collect the posting list of each distinct character
+    QVector<const QVector<int>*> postings;
+    QSet<ushort> seen;
+    foreach(QChar c, lowSearch) {
+        if (seen.contains(c.unicode())) {
+            continue;
+        }
+        seen.insert(c.unicode());
+
+        QHash<ushort, QVector<int>>::const_iterator it = m_postings.constFind(c.unicode());
+        if (it == m_postings.constEnd()) {
+            return result;
+        }
+        postings.push_back(&it.value());
+    }
+
+    // Intersect starting from the shortest posting list
+    std::sort(postings.begin(), postings.end(),
+              [](const QVector<int>* a, const QVector<int>* b) {
+        return a->size() < b->size();
+    });
+
+    QVector<int> indexed = *postings.first();
+    for (int i = 1; i < postings.size() && !indexed.isEmpty(); ++i) {
+        QVector<int> narrowed;
+        std::set_intersection(indexed.constBegin(), indexed.constEnd(),
+                              postings[i]->constBegin(), postings[i]->constEnd(),
+                              std::back_inserter(narrowed));
+        indexed.swap(narrowed);
+    }
+
+    // The candidates contain all the characters, check their order
+    return filterMatches(indexed.constData(), indexed.count(), lowSearch, nullptr, control);
+}
+
+QVector<int> FastCatalogSnapshot::searchPrefix(const QString& lowSearch,
+                                              const SearchControl* control) const {
+    if (lowSearch.isEmpty()) {
+        return QVector<int>();
+    }
+
+    // Only the items containing the first query character can start with it
+    auto it = m_postings.constFind(lowSearch[0].unicode());
+    if (it == m_postings.constEnd()) {
+        return QVector<int>();
+    }
+    return filterPrefix(it->constData(), it->count(), lowSearch, control);
+}
+
+}
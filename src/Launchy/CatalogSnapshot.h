@@ -0,0 +1,151 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <QVector>
+#include <QHash>
+#include "CatalogItem.h"
+#include "CatalogColumns.h"
+#include "StringPool.h"
+
+namespace launchy {
+
+class FuzzyPattern;
+class SearchControl;
+
+// CatalogItem is a row of the catalog, the search names, usage and timestamp
+// are not kept in the row but in the CatalogColumns of the catalog.
+// The full path is split into its directory, interned in the StringPool of
+// the catalog together with the icon path, and the leaf name after it.
+class CatalogItem {
+public:
+    CatalogItem();
+    CatalogItem(const CatItem& item, StringPool& strings);
+
+    QString fullPath(const QVector<QString>& strings) const;
+    bool hasFullPath(const QString& fullPath, const QVector<QString>& strings) const;
+    // Copy the fields kept in the row into a CatItem
+    void fill(CatItem& item, const QVector<QString>& strings) const;
+
+    // Approximate heap bytes of the row, excluding the interned strings
+    qint64 memoryUsage() const;
+
+    // Split a full path after its last separator
+    static int splitPosition(const QString& fullPath);
+
+public:
+    QString shortName;
+    QString leaf;
+    void* data;
+    uint pluginId;
+    // Handles into the catalog StringPool
+    int directory;
+    int iconPath;
+};
+
+
+// CatalogSnapshot is an immutable version of the catalog contents.
+// The catalog publishes a new snapshot whenever a batch of changes is done,
+// searches read the last published one without taking the catalog lock.
+// The rows and columns are implicitly shared with the catalog, so taking
+// a snapshot is cheap and the catalog copies them on its next change.
+class CatalogSnapshot {
+public:
+    CatalogSnapshot();
+    CatalogSnapshot(const QVector<CatalogItem>& items, const CatalogColumns& columns,
+                    const QVector<QString>& strings);
+    virtual ~CatalogSnapshot();
+
+    int count() const;
+    // Return a complete copy of the item at index i
+    CatItem item(int i) const;
+    bool isSameItem(int i, const QString& shortName, const QString& fullPath) const;
+
+    // Return the indices of the items matching the search text, when
+    // candidates is not null only the items it lists are checked,
+    // the search stops early when control says so
+    virtual QVector<int> search(const QString& searchText, const QVector<int>* candidates,
+                                const SearchControl* control = nullptr) const;
+    // Return the indices of the items whose lower case or transliterated
+    // name starts with the lower case query, a quick first stage of search
+    virtual QVector<int> searchPrefix(const QString& lowSearch,
+                                      const SearchControl* control = nullptr) const;
+    // Partially order matched item indices, so that [first, last) holds the
+    // best matches of [first, end) from the best to the worst
+    void sortMatches(QVector<int>& matches, int first, int last, const QString& searchText) const;
+
+    // Typos tolerated for the lower case query, 0 when fuzzy matching is off
+    static int fuzzyEdits(const QString& lowSearch);
+
+protected:
+    // The image is written straight from the rows and columns
+    friend class CatalogImage;
+
+    // Check item i against a lower case query using the packed search names,
+    // when fuzzy is not null items within its edit budget match too
+    bool matchesAt(int i, const QString& lowSearch, const FuzzyPattern* fuzzy) const;
+    // Return the items among indices[0, count), or among [0, count) when
+    // indices is null, matching lowSearch in their original order,
+    // large inputs are checked in shards on the thread pool
+    QVector<int> filterMatches(const int* indices, int count, const QString& lowSearch,
+                               const FuzzyPattern* fuzzy, const SearchControl* control) const;
+    QVector<int> filterShard(const int* indices, int begin, int end, const QString& lowSearch,
+                             const FuzzyPattern* fuzzy, const SearchControl* control) const;
+    QVector<int> filterPrefix(const int* indices, int count, const QString& lowSearch,
+                              const SearchControl* control) const;
+
+protected:
+    QVector<CatalogItem> m_items;
+    CatalogColumns m_columns;
+    QVector<QString> m_strings;
+};
+
+typedef std::shared_ptr<const CatalogSnapshot> CatalogSnapshotPtr;
+
+
+// Snapshot of a FastCatalog, searches intersect the posting lists
+// of the query characters before checking the remaining candidates
+class FastCatalogSnapshot : public CatalogSnapshot {
+public:
+    FastCatalogSnapshot(const QVector<CatalogItem>& items, const CatalogColumns& columns,
+                        const QVector<QString>& strings,
+                        const QHash<ushort, QVector<int>>& postings);
+
+    virtual QVector<int> search(const QString& searchText, const QVector<int>* candidates,
+                                const SearchControl* control = nullptr) const;
+    virtual QVector<int> searchPrefix(const QString& lowSearch,
+                                      const SearchControl* control = nullptr) const;
+
+private:
+    QHash<ushort, QVector<int>> m_postings;
+};
+
+inline QString CatalogItem::fullPath(const QVector<QString>& strings) const {
+    return strings[directory] + leaf;
+}
+
+// Removed rows keep their index until the catalog drops them
+inline int CatalogSnapshot::count() const {
+    return m_items.count() - m_columns.removedCount();
+}
+
+}
+
+Q_DECLARE_TYPEINFO(launchy::CatalogItem, Q_MOVABLE_TYPE);
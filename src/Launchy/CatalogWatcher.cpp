@@ -0,0 +1,340 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "CatalogWatcher.h"
+#include <algorithm>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include "Catalog.h"
+#include "GlobalVar.h"
+#include "OptionItem.h"
+
+namespace launchy {
+
+// Milliseconds a change waits for the rest of its burst
+static const int UPDATE_DELAY = 500;
+
+// Items are identified like the rows of the catalog
+static QString identity(const CatItem& item) {
+    return item.fullPath + QChar(0) + item.shortName;
+}
+
+static QStringList identitiesOf(const QList<CatItem>& items) {
+    QStringList result;
+    result.reserve(items.size());
+    foreach(const CatItem& item, items) {
+        result.push_back(identity(item));
+    }
+    return result;
+}
+
+// The catalog finds the row of an item by its identity alone
+static QList<CatItem> identifiedItems(const QStringList& identities) {
+    QList<CatItem> result;
+    foreach(const QString& id, identities) {
+        int split = id.indexOf(QChar(0));
+        CatItem item;
+        item.fullPath = id.left(split);
+        item.shortName = id.mid(split + 1);
+        result.push_back(item);
+    }
+    return result;
+}
+
+CatalogWatcher::CatalogWatcher(Catalog* catalog, QObject* parent)
+    : QObject(parent),
+      m_catalog(catalog),
+      m_watcher(nullptr),
+      m_overflowed(0) {
+    m_updateTimer.setSingleShot(true);
+    m_updateTimer.setInterval(UPDATE_DELAY);
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(onUpdateTimeout()));
+    connect(&m_scanTimer, SIGNAL(timeout()), this, SLOT(onScanTimeout()));
+    createWatcher();
+}
+
+CatalogWatcher::~CatalogWatcher() {
+}
+
+void CatalogWatcher::createWatcher() {
+    delete m_watcher;
+    m_watcher = new QFileSystemWatcher(this);
+    connect(m_watcher, SIGNAL(directoryChanged(const QString&)),
+            this, SLOT(onDirectoryChanged(const QString&)));
+}
+
+void CatalogWatcher::reset(const QList<Directory>& roots,
+                           const QVector<DirectoryIndexer::ScannedDirectory>& scanned) {
+    QElapsedTimer timer;
+    timer.start();
+
+    // Dropping every watch at once is much cheaper than one by one
+    createWatcher();
+    m_directories.clear();
+    m_overflowed = 0;
+    m_scanners.clear();
+    foreach(const Directory& root, roots) {
+        m_scanners.push_back(DirectoryScanner(root));
+    }
+
+    // Overlapping catalog directories may scan a directory more than once
+    foreach(const DirectoryIndexer::ScannedDirectory& directory, scanned) {
+        WatchedDirectory& watched = m_directories[directory.path];
+        Registration registration = { directory.root, directory.depth };
+        watched.registrations.push_back(registration);
+        watched.identities += identitiesOf(directory.items);
+        watched.watched = false;
+    }
+
+    for (auto it = m_directories.cbegin(); it != m_directories.cend(); ++it) {
+        QString parent = it.key().left(it.key().lastIndexOf('/'));
+        auto parentIt = m_directories.find(parent);
+        if (parentIt != m_directories.end() && !parentIt->subdirectories.contains(it.key())) {
+            parentIt->subdirectories.push_back(it.key());
+        }
+    }
+
+    watch(m_directories.keys());
+
+    // What cannot be watched is as fresh as the rebuilds used to keep it
+    int minutes = g_settings->value(OPTION_REBUILDTIMER, OPTION_REBUILDTIMER_DEFAULT).toInt();
+    m_scanTimer.stop();
+    m_scanTimer.setInterval(minutes * 60000);
+    if (m_overflowed > 0 && minutes > 0) {
+        m_scanTimer.start();
+    }
+
+    qInfo() << "CatalogWatcher::reset, watching" << m_directories.size() - m_overflowed
+        << "directories," << m_overflowed << "beyond the watch limit, in"
+        << timer.elapsed() << "ms";
+}
+
+void CatalogWatcher::onDirectoryChanged(const QString& path) {
+    m_changed.insert(path);
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start();
+    }
+}
+
+void CatalogWatcher::onUpdateTimeout() {
+    QElapsedTimer timer;
+    timer.start();
+
+    // Parents first, a removed parent takes its changed children along
+    QStringList changed;
+    foreach(const QString& path, m_changed) {
+        changed.push_back(path);
+    }
+    m_changed.clear();
+    std::sort(changed.begin(), changed.end());
+    foreach(const QString& path, changed) {
+        update(path);
+    }
+    m_catalog->publish();
+
+    qDebug() << "CatalogWatcher::onUpdateTimeout," << changed.size()
+        << "directories updated in" << timer.elapsed() << "ms";
+}
+
+void CatalogWatcher::onScanTimeout() {
+    QElapsedTimer timer;
+    timer.start();
+
+    // Watches may have been freed since, the directories which get one
+    // are rescanned all the same for the changes made meanwhile
+    QStringList overflowed;
+    for (auto it = m_directories.cbegin(); it != m_directories.cend(); ++it) {
+        if (!it->watched) {
+            overflowed.push_back(it.key());
+        }
+    }
+    m_overflowed -= overflowed.size();
+    watch(overflowed);
+
+    std::sort(overflowed.begin(), overflowed.end());
+    foreach(const QString& path, overflowed) {
+        update(path);
+    }
+    m_catalog->publish();
+
+    if (m_overflowed == 0) {
+        m_scanTimer.stop();
+    }
+    qInfo() << "CatalogWatcher::onScanTimeout," << overflowed.size()
+        << "directories rescanned in" << timer.elapsed() << "ms";
+}
+
+void CatalogWatcher::update(const QString& path) {
+    if (!m_directories.contains(path)) {
+        return;
+    }
+
+    // A removed or renamed directory, its parent drops its item
+    if (!QFileInfo(path).isDir()) {
+        removeTree(path);
+        return;
+    }
+
+    QVector<Registration> registrations = m_directories.value(path).registrations;
+    QList<CatItem> items;
+    QStringList subdirectories;
+    QSet<QString> identities;
+    QList<QPair<QString, Registration>> added;
+    foreach(const Registration& registration, registrations) {
+        QList<CatItem> listed;
+        QStringList listedSubdirectories;
+        m_scanners.at(registration.root).scan(path, registration.depth,
+                                              listed, listedSubdirectories);
+        foreach(const CatItem& item, listed) {
+            QString id = identity(item);
+            if (!identities.contains(id)) {
+                identities.insert(id);
+                items.push_back(item);
+            }
+        }
+        foreach(const QString& subdirectory, listedSubdirectories) {
+            if (subdirectories.contains(subdirectory)) {
+                continue;
+            }
+            subdirectories.push_back(subdirectory);
+            if (!m_directories.contains(subdirectory)) {
+                Registration next = { registration.root, registration.depth - 1 };
+                added.push_back(qMakePair(subdirectory, next));
+            }
+        }
+    }
+
+    const WatchedDirectory& old = m_directories[path];
+    QStringList removed;
+    foreach(const QString& id, old.identities) {
+        if (!identities.contains(id)) {
+            removed.push_back(id);
+        }
+    }
+    QStringList removedSubdirectories;
+    foreach(const QString& subdirectory, old.subdirectories) {
+        if (!subdirectories.contains(subdirectory)) {
+            removedSubdirectories.push_back(subdirectory);
+        }
+    }
+
+    // Unchanged items are found again and not journaled
+    m_catalog->removeItems(identifiedItems(removed));
+    m_catalog->addItems(items);
+
+    WatchedDirectory& watched = m_directories[path];
+    watched.identities = identities.values();
+    watched.subdirectories = subdirectories;
+
+    foreach(const QString& subdirectory, removedSubdirectories) {
+        removeTree(subdirectory);
+    }
+    for (int i = 0; i < added.size(); ++i) {
+        addTree(added[i].first, added[i].second);
+    }
+}
+
+void CatalogWatcher::addTree(const QString& path, const Registration& registration) {
+    QList<QPair<QString, int>> queue;
+    queue.push_back(qMakePair(path, registration.depth));
+    while (!queue.isEmpty()) {
+        QPair<QString, int> next = queue.takeFirst();
+        if (m_directories.contains(next.first)) {
+            continue;
+        }
+
+        // Watched before the listing, so that nothing created meanwhile is missed
+        WatchedDirectory& watched = m_directories[next.first];
+        Registration nextRegistration = { registration.root, next.second };
+        watched.registrations.push_back(nextRegistration);
+        watched.watched = false;
+        watch(QStringList(next.first));
+
+        QList<CatItem> items;
+        QStringList subdirectories;
+        m_scanners.at(registration.root).scan(next.first, next.second, items, subdirectories);
+        m_catalog->addItems(items);
+
+        WatchedDirectory& scanned = m_directories[next.first];
+        scanned.identities = identitiesOf(items);
+        scanned.subdirectories = subdirectories;
+        foreach(const QString& subdirectory, subdirectories) {
+            queue.push_back(qMakePair(subdirectory, next.second - 1));
+        }
+    }
+}
+
+void CatalogWatcher::removeTree(const QString& path) {
+    QString prefix = path + "/";
+    QStringList removed;
+    QStringList watched;
+    for (auto it = m_directories.begin(); it != m_directories.end();) {
+        if (it.key() == path || it.key().startsWith(prefix)) {
+            removed += it->identities;
+            if (it->watched) {
+                watched.push_back(it.key());
+            }
+            else {
+                --m_overflowed;
+            }
+            it = m_directories.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    // The watches of removed directories are gone already, the others were renamed
+    if (!watched.isEmpty()) {
+        m_watcher->removePaths(watched);
+    }
+    m_catalog->removeItems(identifiedItems(removed));
+}
+
+void CatalogWatcher::watch(const QStringList& paths) {
+    if (paths.isEmpty()) {
+        return;
+    }
+
+    QStringList failed = m_watcher->addPaths(paths);
+    QSet<QString> overflowed;
+    foreach(const QString& path, failed) {
+        overflowed.insert(path);
+    }
+    foreach(const QString& path, paths) {
+        auto it = m_directories.find(path);
+        if (it != m_directories.end()) {
+            it->watched = !overflowed.contains(path);
+        }
+    }
+
+    if (!failed.isEmpty()) {
+        if (m_overflowed == 0) {
+            qWarning() << "CatalogWatcher::watch, watch limit reached at" << failed.first()
+                << "directories beyond it are rescanned periodically";
+        }
+        m_overflowed += failed.size();
+        if (!m_scanTimer.isActive() && m_scanTimer.interval() > 0) {
+            m_scanTimer.start();
+        }
+    }
+}
+
+}
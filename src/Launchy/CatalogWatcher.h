@@ -0,0 +1,94 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <QObject>
+#include <QHash>
+#include <QSet>
+#include <QTimer>
+#include "DirectoryIndexer.h"
+
+class QFileSystemWatcher;
+
+namespace launchy {
+
+class Catalog;
+
+// CatalogWatcher keeps the catalog up to date between full builds. It watches
+// the directories a build scanned, relists a directory once it changes and
+// applies the difference to the catalog, new subdirectories within the depth
+// of their catalog directory are indexed and watched as well.
+// Directories beyond the watch limit of the system are rescanned every rebuild
+// interval instead. It lives in the thread of the catalog builder.
+class CatalogWatcher : public QObject {
+    Q_OBJECT
+public:
+    explicit CatalogWatcher(Catalog* catalog, QObject* parent = nullptr);
+    virtual ~CatalogWatcher();
+
+    // Watch the directories a full build scanned instead of the previous ones
+    void reset(const QList<Directory>& roots,
+               const QVector<DirectoryIndexer::ScannedDirectory>& scanned);
+
+private slots:
+    void onDirectoryChanged(const QString& path);
+    void onUpdateTimeout();
+    void onScanTimeout();
+
+private:
+    // A catalog directory and the depth left below the watched directory
+    struct Registration {
+        int root;
+        int depth;
+    };
+
+    struct WatchedDirectory {
+        QVector<Registration> registrations;
+        // The identities of the items of the last listing, the catalog
+        // holds the items themselves, and the subdirectories descended into
+        QStringList identities;
+        QStringList subdirectories;
+        bool watched;
+    };
+
+    // List a directory again and apply the difference to the catalog
+    void update(const QString& path);
+    // Index and watch a new directory and everything within its depth
+    void addTree(const QString& path, const Registration& registration);
+    // Drop a directory and everything below it
+    void removeTree(const QString& path);
+    void watch(const QStringList& paths);
+    void createWatcher();
+
+private:
+    Catalog* m_catalog;
+    QFileSystemWatcher* m_watcher;
+    // One per catalog directory
+    QVector<DirectoryScanner> m_scanners;
+    QHash<QString, WatchedDirectory> m_directories;
+    // Directories beyond the watch limit
+    int m_overflowed;
+    // Changes coming in bursts are applied together
+    QSet<QString> m_changed;
+    QTimer m_updateTimer;
+    QTimer m_scanTimer;
+};
+
+}
@@ -19,7 +19,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include "CharListWidget.h"
 #include "IconDelegate.h"
-#include "OptionItem.h"
+#include "SettingsSnapshot.h"
 #include "LaunchyLib.h"
 
 namespace launchy {
@@ -43,11 +43,25 @@ CharListWidget::CharListWidget(QWidget* parent)
     m_alternativePath->setObjectName("alternativesPath");
     m_alternativePath->hide();
     m_iconListDelegate->setAlternativePathWidget(m_alternativePath);
+
+    connect(verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(checkEndReached()));
+    connect(this, SIGNAL(currentRowChanged(int)), this, SLOT(checkEndReached()));
+}
+
+void CharListWidget::checkEndReached() {
+    if (count() == 0) {
+        return;
+    }
+    QScrollBar* scrollBar = verticalScrollBar();
+    if (currentRow() == count() - 1
+        || (scrollBar->maximum() > 0 && scrollBar->value() == scrollBar->maximum())) {
+        emit endReached();
+    }
 }
 
 void CharListWidget::updateGeometry(const QPoint& basePos, const QPoint& offset) {
     // Now resize and reposition the list
-    int numViewable = g_settings->value(OPSTION_NUMVIEWABLE, OPSTION_NUMVIEWABLE_DEFAULT).toInt();
+    int numViewable = SettingsSnapshot::current()->numViewable;
     int min = count() < numViewable ? count() : numViewable;
 
     // The stylesheet doesn't load immediately, so we cache the placement rectangle here
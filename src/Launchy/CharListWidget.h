@@ -44,6 +44,11 @@ signals:
     void keyPressed(QKeyEvent* event);
     void focusIn();
     void focusOut();
+    // The last row is selected or scrolled into view
+    void endReached();
+
+private slots:
+    void checkEndReached();
 
 private:
     QRect m_baseGeometry;
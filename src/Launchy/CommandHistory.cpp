@@ -19,7 +19,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include "CommandHistory.h"
 #include "GlobalVar.h"
-#include "OptionItem.h"
+#include "SettingsSnapshot.h"
 
 namespace launchy {
 CommandHistory::CommandHistory() {
@@ -65,8 +65,7 @@ void CommandHistory::addItem(const InputDataList& item) {
         return;
     }
 
-    int historyMax = g_settings->value(OPSTION_MAXITEMSINHISTORY,
-                                       OPSTION_MAXITEMSINHISTORY_DEFAULT).toInt();
+    int historyMax = SettingsSnapshot::current()->maxItemsInHistory;
     if (historyMax <= 0) {
         m_history.clear();
         return;
@@ -0,0 +1,336 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "DirectoryIndexer.h"
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStorageInfo>
+#include <QThread>
+#include <QtConcurrent>
+#include "Catalog.h"
+#ifdef Q_OS_UNIX
+#include <sys/stat.h>
+#endif
+
+namespace launchy {
+
+// Bumped whenever the layout of the fingerprints file or the way
+// directories are listed changes, the earlier listings are dropped then
+static const quint32 FINGERPRINTS_VERSION = 2;
+
+// Changes within this many milliseconds of a listing may share its
+// modification time on coarse filesystems, such directories are listed again
+static const qint64 MODIFIED_RESOLUTION = 2000;
+
+DirectoryIndexer::DirectoryIndexer(Catalog* catalog, int threads, int threadsPerDevice)
+    : m_catalog(catalog),
+      m_threadsPerDevice(qMax(1, threadsPerDevice)),
+      m_returned(0),
+      m_reused(0) {
+    if (threads > 0) {
+        m_pool.setMaxThreadCount(threads);
+    }
+}
+
+DirectoryIndexer::~DirectoryIndexer() {
+    m_pool.waitForDone();
+}
+
+void DirectoryIndexer::setPrevious(const QVector<ScannedDirectory>& previous) {
+    m_previous.clear();
+    m_previous.reserve(previous.size());
+    foreach(const ScannedDirectory& directory, previous) {
+        m_previous.insert(directory.path, directory);
+    }
+}
+
+void DirectoryIndexer::start(const QList<Directory>& directories) {
+    {
+        QMutexLocker locker(&m_mutex);
+        foreach(const Directory& directory, directories) {
+            // Subdirectories are counted on the filesystem of their root
+            QStorageInfo storage(directory.name);
+            Root root = { directory, DirectoryScanner(directory), optionsKey(directory),
+                          storage.isValid() ? storage.device() : QByteArray(), 0 };
+            m_roots.push_back(root);
+        }
+    }
+
+    for (int i = 0; i < directories.size(); ++i) {
+        Task task = { i, directories[i].name, directories[i].depth };
+        schedule(task);
+    }
+}
+
+int DirectoryIndexer::waitForDirectory() {
+    QMutexLocker locker(&m_mutex);
+    if (m_returned >= m_roots.size()) {
+        return -1;
+    }
+    while (m_finished.isEmpty()) {
+        m_rootFinished.wait(&m_mutex);
+    }
+    ++m_returned;
+    return m_finished.dequeue();
+}
+
+QVector<DirectoryIndexer::ScannedDirectory> DirectoryIndexer::scannedDirectories() const {
+    QMutexLocker locker(&m_indexedMutex);
+    return m_scanned;
+}
+
+int DirectoryIndexer::reusedCount() const {
+    return m_reused.load();
+}
+
+void DirectoryIndexer::schedule(const Task& task) {
+    QMutexLocker locker(&m_mutex);
+    Root& root = m_roots[task.root];
+    ++root.pending;
+
+    Device& device = m_devices[root.device];
+    if (device.running < m_threadsPerDevice) {
+        ++device.running;
+        QtConcurrent::run(&m_pool, [this, task]() {
+            run(task);
+        });
+    }
+    else {
+        device.waiting.enqueue(task);
+    }
+}
+
+void DirectoryIndexer::run(const Task& task) {
+    // Indexing stays in the background like the builder thread
+    QThread::currentThread()->setPriority(QThread::IdlePriority);
+    indexDirectory(task);
+    finish(task);
+}
+
+// The thread of a finished task goes on with the next task waiting for
+// the same filesystem, if any
+void DirectoryIndexer::finish(const Task& task) {
+    QMutexLocker locker(&m_mutex);
+    Root& root = m_roots[task.root];
+    Device& device = m_devices[root.device];
+    if (!device.waiting.isEmpty()) {
+        Task next = device.waiting.dequeue();
+        QtConcurrent::run(&m_pool, [this, next]() {
+            run(next);
+        });
+    }
+    else {
+        --device.running;
+    }
+
+    // The subdirectories were scheduled before, so the root
+    // is done once its last task finishes
+    if (--root.pending == 0) {
+        m_finished.enqueue(task.root);
+        m_rootFinished.wakeAll();
+    }
+}
+
+void DirectoryIndexer::indexDirectory(const Task& task) {
+    // The roots do not change once started
+    const Root& root = m_roots.at(task.root);
+    ScannedDirectory scanned;
+    scanned.path = QDir(QDir::toNativeSeparators(task.path)).absolutePath();
+    scanned.root = task.root;
+    scanned.depth = task.depth;
+    scanned.options = root.options;
+
+    const ScannedDirectory* previous = nullptr;
+    if (readFingerprint(scanned.path, scanned.fingerprint)) {
+        previous = findPrevious(scanned.path, scanned);
+    }
+    else {
+        scanned.fingerprint = Fingerprint();
+    }
+
+    if (previous) {
+        // Unchanged since the earlier build, adding its items again
+        // marks them with the current generation. Their files are claimed
+        // as a listing would, another catalog directory may have taken them
+        scanned.scanned = previous->scanned;
+        scanned.subdirectories = previous->subdirectories;
+        for (int i = 0; i < previous->items.size(); ++i) {
+            const QString& source = previous->sources.at(i);
+            if (source.isEmpty() || claim(source)) {
+                scanned.items.push_back(previous->items.at(i));
+                scanned.sources.push_back(source);
+            }
+        }
+        m_reused.ref();
+    }
+    else {
+        scanned.scanned = QDateTime::currentMSecsSinceEpoch();
+        scanned.path = root.scanner.scan(task.path, task.depth, scanned.items,
+                                         scanned.subdirectories, this, &scanned.sources);
+    }
+
+    foreach(const QString& subdirectory, scanned.subdirectories) {
+        Task next = { task.root, subdirectory, task.depth - 1 };
+        schedule(next);
+    }
+    m_catalog->addItems(scanned.items);
+
+    QMutexLocker locker(&m_indexedMutex);
+    m_scanned.push_back(scanned);
+}
+
+const DirectoryIndexer::ScannedDirectory* DirectoryIndexer::findPrevious(
+    const QString& path, const ScannedDirectory& current) const {
+    for (auto it = m_previous.find(path); it != m_previous.end() && it.key() == path; ++it) {
+        const ScannedDirectory& previous = it.value();
+        if (previous.depth == current.depth
+            && previous.options == current.options
+            && previous.fingerprint == current.fingerprint
+            && previous.scanned - previous.fingerprint.modified > MODIFIED_RESOLUTION) {
+            return &previous;
+        }
+    }
+    return nullptr;
+}
+
+bool DirectoryIndexer::readFingerprint(const QString& path, Fingerprint& fingerprint) {
+#ifdef Q_OS_UNIX
+    // A single stat, QFileInfo has no inode
+    struct stat status;
+    if (::stat(QFile::encodeName(path).constData(), &status) != 0) {
+        return false;
+    }
+#ifdef Q_OS_MAC
+    const struct timespec& modified = status.st_mtimespec;
+#else
+    const struct timespec& modified = status.st_mtim;
+#endif
+    fingerprint.modified = qint64(modified.tv_sec) * 1000 + modified.tv_nsec / 1000000;
+    fingerprint.inode = status.st_ino;
+    fingerprint.size = status.st_size;
+#else
+    QFileInfo info(path);
+    if (!info.exists()) {
+        return false;
+    }
+    fingerprint.modified = info.lastModified().toMSecsSinceEpoch();
+    fingerprint.inode = 0;
+    fingerprint.size = info.size();
+#endif
+    return true;
+}
+
+// Changing the options of a catalog directory changes what its
+// directories yield, the earlier listings are not used then
+QString DirectoryIndexer::optionsKey(const Directory& directory) {
+    return directory.types.join(";")
+        + (directory.indexDirs ? ";dirs" : "")
+        + (directory.indexExe ? ";exe" : "");
+}
+
+QVector<DirectoryIndexer::ScannedDirectory> DirectoryIndexer::readFingerprints(
+    const QString& catalogFilename) {
+    QVector<ScannedDirectory> directories;
+    QFile file(fingerprintsFilename(catalogFilename));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return directories;
+    }
+
+    QByteArray data = qUncompress(file.readAll());
+    QDataStream in(&data, QIODevice::ReadOnly);
+    in.setVersion(QDataStream::Qt_5_0);
+    quint32 version = 0;
+    quint32 count = 0;
+    in >> version >> count;
+    if (version != FINGERPRINTS_VERSION) {
+        qInfo() << "DirectoryIndexer::readFingerprints, every directory is listed again,"
+            << "fingerprints version:" << version;
+        return directories;
+    }
+
+    directories.reserve(count);
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        ScannedDirectory directory;
+        qint32 depth;
+        in >> directory.path >> depth >> directory.options
+           >> directory.fingerprint.modified >> directory.fingerprint.inode
+           >> directory.fingerprint.size >> directory.scanned
+           >> directory.items >> directory.sources >> directory.subdirectories;
+        if (directory.sources.size() != directory.items.size()) {
+            in.setStatus(QDataStream::ReadCorruptData);
+        }
+        directory.root = -1;
+        directory.depth = depth;
+        directories.push_back(directory);
+    }
+
+    // A damaged file only costs listing every directory once
+    if (in.status() != QDataStream::Ok) {
+        qWarning() << "DirectoryIndexer::readFingerprints, fail to read fingerprints file:"
+            << file.fileName();
+        directories.clear();
+    }
+    return directories;
+}
+
+bool DirectoryIndexer::writeFingerprints(const QString& catalogFilename,
+                                         const QVector<ScannedDirectory>& directories) {
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << FINGERPRINTS_VERSION << quint32(directories.size());
+    foreach(const ScannedDirectory& directory, directories) {
+        out << directory.path << qint32(directory.depth) << directory.options
+            << directory.fingerprint.modified << directory.fingerprint.inode
+            << directory.fingerprint.size << directory.scanned
+            << directory.items << directory.sources << directory.subdirectories;
+    }
+
+    QSaveFile file(fingerprintsFilename(catalogFilename));
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(qCompress(data)) < 0
+        || !file.commit()) {
+        qWarning() << "DirectoryIndexer::writeFingerprints, fail to write fingerprints file:"
+            << file.fileName();
+        return false;
+    }
+    return true;
+}
+
+QString DirectoryIndexer::fingerprintsFilename(const QString& catalogFilename) {
+    return catalogFilename + ".dirs";
+}
+
+bool DirectoryIndexer::claim(const QString& path) {
+    QMutexLocker locker(&m_indexedMutex);
+    int count = m_indexed.size();
+    m_indexed.insert(path);
+    return m_indexed.size() != count;
+}
+
+bool DirectoryIndexer::isIndexed(const QString& path) {
+    QMutexLocker locker(&m_indexedMutex);
+    return m_indexed.contains(path);
+}
+
+}
@@ -0,0 +1,161 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <QByteArray>
+#include <QAtomicInt>
+#include <QHash>
+#include <QMultiHash>
+#include <QMutex>
+#include <QQueue>
+#include <QSet>
+#include <QString>
+#include <QThreadPool>
+#include <QVector>
+#include <QWaitCondition>
+#include "CatalogItem.h"
+#include "Directory.h"
+#include "DirectoryScanner.h"
+
+namespace launchy {
+
+class Catalog;
+
+// DirectoryIndexer walks the catalog directories in parallel. Listing one
+// directory is a task, the subdirectories it finds are queued as new tasks
+// which any idle thread of the pool picks up, so a single deep tree keeps
+// every thread busy and no thread waits on a root it started.
+// Every filesystem has its own cap of concurrent listings, the tasks above
+// the cap wait in a queue of their filesystem instead of holding a thread,
+// so a slow network mount cannot stall the local disks.
+// A directory whose fingerprint did not change since an earlier build is not
+// listed again, the items and subdirectories of that build are used instead.
+class DirectoryIndexer {
+public:
+    // Adding, removing or renaming an entry of a directory changes at least
+    // its modification time, the inode changes when it is replaced
+    struct Fingerprint {
+        // Milliseconds since the epoch
+        qint64 modified;
+        quint64 inode;
+        qint64 size;
+
+        bool operator==(const Fingerprint& other) const {
+            return modified == other.modified && inode == other.inode && size == other.size;
+        }
+    };
+
+    // A directory listed by the indexer and the items it added for it
+    struct ScannedDirectory {
+        QString path;
+        // Index of the configured directory and depth left below this one
+        int root;
+        int depth;
+        // The options of the configured directory, see optionsKey()
+        QString options;
+        Fingerprint fingerprint;
+        // When it was listed, in milliseconds since the epoch
+        qint64 scanned;
+        QList<CatItem> items;
+        // The file each item was claimed as, see DirectoryScanner::scan()
+        QStringList sources;
+        QStringList subdirectories;
+    };
+
+    DirectoryIndexer(Catalog* catalog, int threads, int threadsPerDevice);
+    ~DirectoryIndexer();
+
+    // The directories an earlier build listed, see readFingerprints()
+    void setPrevious(const QVector<ScannedDirectory>& previous);
+    // Start indexing the directories, returns right away
+    void start(const QList<Directory>& directories);
+    // Wait until the whole tree of one of the directories is indexed and
+    // return its index, or -1 once every directory has been returned
+    int waitForDirectory();
+    // The directories listed or reused so far
+    QVector<ScannedDirectory> scannedDirectories() const;
+    // The directories reused from the earlier build so far
+    int reusedCount() const;
+
+    // The scanned directories of the last build are kept next to the catalog
+    static QVector<ScannedDirectory> readFingerprints(const QString& catalogFilename);
+    static bool writeFingerprints(const QString& catalogFilename,
+                                  const QVector<ScannedDirectory>& directories);
+    static QString fingerprintsFilename(const QString& catalogFilename);
+
+    // Mark path as indexed, return false if it already was
+    bool claim(const QString& path);
+    bool isIndexed(const QString& path);
+
+private:
+    struct Task {
+        int root;
+        QString path;
+        int depth;
+    };
+
+    struct Root {
+        Directory directory;
+        DirectoryScanner scanner;
+        QString options;
+        QByteArray device;
+        // Tasks of the root queued or running
+        int pending;
+    };
+
+    struct Device {
+        int running;
+        QQueue<Task> waiting;
+    };
+
+    void schedule(const Task& task);
+    void run(const Task& task);
+    void finish(const Task& task);
+    void indexDirectory(const Task& task);
+    // Return the earlier listing of a directory if it is still valid
+    const ScannedDirectory* findPrevious(const QString& path, const ScannedDirectory& current) const;
+    static bool readFingerprint(const QString& path, Fingerprint& fingerprint);
+    static QString optionsKey(const Directory& directory);
+
+private:
+    Catalog* m_catalog;
+    QThreadPool m_pool;
+    int m_threadsPerDevice;
+
+    // Guards the roots, devices and finished roots
+    QMutex m_mutex;
+    QWaitCondition m_rootFinished;
+    QVector<Root> m_roots;
+    QHash<QByteArray, Device> m_devices;
+    QQueue<int> m_finished;
+    int m_returned;
+
+    // Every path is added to the catalog once per build,
+    // the scanned directories are guarded by the same mutex
+    mutable QMutex m_indexedMutex;
+    QSet<QString> m_indexed;
+    QVector<ScannedDirectory> m_scanned;
+
+    // Read only once started
+    QMultiHash<QString, ScannedDirectory> m_previous;
+    QAtomicInt m_reused;
+};
+
+}
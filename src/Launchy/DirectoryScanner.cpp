@@ -0,0 +1,266 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "DirectoryScanner.h"
+#include <QDir>
+#include <QFile>
+#include "AppBase.h"
+#include "DirectoryIndexer.h"
+#ifdef Q_OS_UNIX
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <QDirIterator>
+#include <QFileInfo>
+#endif
+
+namespace launchy {
+
+namespace {
+
+enum EntryType {
+    DirectoryEntry,
+    FileEntry,
+    // Special files and broken links, the type filters still list them
+    OtherEntry
+};
+
+// Call visit(name, type, executable) for every entry of dir but the hidden
+// ones, like QDir does, executable is only checked when executables is set
+template<typename Visit>
+void listDirectory(const QString& dir, bool executables, Visit visit) {
+#ifdef Q_OS_UNIX
+    DIR* handle = ::opendir(QFile::encodeName(dir).constData());
+    if (!handle) {
+        return;
+    }
+    int fd = ::dirfd(handle);
+
+    while (struct dirent* entry = ::readdir(handle)) {
+        const char* name = entry->d_name;
+        // "." and ".." are hidden too
+        if (name[0] == '.') {
+            continue;
+        }
+
+        EntryType type = OtherEntry;
+        switch (entry->d_type) {
+        case DT_DIR:
+            type = DirectoryEntry;
+            break;
+        case DT_REG:
+            type = FileEntry;
+            break;
+        case DT_LNK:
+        case DT_UNKNOWN: {
+            // Links are followed like QDir does
+            struct stat status;
+            if (::fstatat(fd, name, &status, 0) == 0) {
+                if (S_ISDIR(status.st_mode)) {
+                    type = DirectoryEntry;
+                }
+                else if (S_ISREG(status.st_mode)) {
+                    type = FileEntry;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        bool executable = executables && type == FileEntry
+            && ::faccessat(fd, name, X_OK, 0) == 0;
+        visit(QFile::decodeName(name), type, executable);
+    }
+    ::closedir(handle);
+#else
+    // The iterator fills the file information from the listing itself
+    QDirIterator it(dir, QDir::AllEntries | QDir::System | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        it.next();
+        QFileInfo info = it.fileInfo();
+        EntryType type = info.isDir() ? DirectoryEntry : info.isFile() ? FileEntry : OtherEntry;
+        bool executable = executables && type == FileEntry && info.isExecutable();
+        visit(info.fileName(), type, executable);
+    }
+#endif
+}
+
+bool isWildcard(const QString& text) {
+    return text.contains('*') || text.contains('?') || text.contains('[');
+}
+
+// The wildcards of QDir name filters as an anchored regular expression
+QString wildcardToPattern(const QString& wildcard) {
+    QString pattern = "\\A(?:";
+    for (int i = 0; i < wildcard.size(); ++i) {
+        QChar c = wildcard[i];
+        if (c == '*') {
+            pattern += ".*";
+        }
+        else if (c == '?') {
+            pattern += '.';
+        }
+        else if (c == '[') {
+            int end = wildcard.indexOf(']', i + 2);
+            if (end < 0) {
+                pattern += "\\[";
+                continue;
+            }
+            // A set, "[!...]" excludes its characters
+            QString set = wildcard.mid(i + 1, end - i - 1);
+            if (set.startsWith('!')) {
+                set[0] = '^';
+            }
+            pattern += '[';
+            pattern += set.replace("\\", "\\\\");
+            pattern += ']';
+            i = end;
+        }
+        else {
+            pattern += QRegularExpression::escape(QString(c));
+        }
+    }
+    return pattern + ")\\z";
+}
+
+}
+
+DirectoryScanner::DirectoryScanner()
+    : m_matchAll(false) {
+}
+
+DirectoryScanner::DirectoryScanner(const Directory& directory)
+    : m_directory(directory),
+      m_matchAll(false) {
+    foreach(const QString& type, directory.types) {
+        QString filter = type.trimmed();
+        if (filter == "*") {
+            m_matchAll = true;
+        }
+        else if (filter.startsWith("*.") && !isWildcard(filter.mid(1))) {
+            m_suffixes.insert(filter.mid(1).toLower());
+        }
+        else if (!filter.isEmpty()) {
+            m_patterns.push_back(QRegularExpression(wildcardToPattern(filter),
+                                                   QRegularExpression::CaseInsensitiveOption));
+        }
+    }
+}
+
+bool DirectoryScanner::matches(const QString& name) const {
+    if (m_matchAll) {
+        return true;
+    }
+
+    // Suffixes may span several dots
+    if (!m_suffixes.isEmpty()) {
+        for (int dot = name.indexOf('.'); dot >= 0; dot = name.indexOf('.', dot + 1)) {
+            if (m_suffixes.contains(name.mid(dot).toLower())) {
+                return true;
+            }
+        }
+    }
+
+    foreach(const QRegularExpression& pattern, m_patterns) {
+        if (pattern.match(name).hasMatch()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QString DirectoryScanner::scan(const QString& path, int depth, QList<CatItem>& items,
+                               QStringList& subdirectories, DirectoryIndexer* indexer,
+                               QStringList* sources) const {
+    auto claim = [indexer](const QString& file) {
+        return !indexer || indexer->claim(file);
+    };
+    auto isIndexed = [indexer](const QString& file) {
+        return indexer && indexer->isIndexed(file);
+    };
+    auto add = [&items, sources](const CatItem& item, const QString& source) {
+        items.push_back(item);
+        if (sources) {
+            sources->push_back(source);
+        }
+    };
+
+    QString dir = QDir(QDir::toNativeSeparators(path)).absolutePath();
+    const Directory& options = m_directory;
+    // Don't want a null file filter, that matches everything..
+    bool filterFiles = !options.types.empty();
+
+    listDirectory(dir, options.indexExe, [&](const QString& name, EntryType type, bool executable) {
+        QString fullPath = dir + "/" + name;
+
+        if (type == DirectoryEntry) {
+            bool isShortcut = name.endsWith(".lnk", Qt::CaseInsensitive);
+            if (depth > 0 && !name.contains(".lnk")) {
+#ifdef Q_OS_MAC
+                // Special handling of app directories
+                if (name.endsWith(".app", Qt::CaseInsensitive)) {
+                    CatItem item(fullPath);
+                    g_app->alterItem(&item);
+                    add(item, QString());
+                }
+                else
+#endif
+                    subdirectories.push_back(fullPath);
+            }
+
+            if (options.indexDirs) {
+                if (claim(fullPath)) {
+                    add(CatItem(fullPath, !isShortcut), fullPath);
+                }
+            }
+            // Grab any shortcut directories
+            // This is to work around a QT weirdness that treats shortcuts to directories as actual directories
+            else if (isShortcut && claim(fullPath)) {
+                add(CatItem(fullPath, true), fullPath);
+            }
+            return;
+        }
+
+        if (executable && claim(fullPath)) {
+            add(CatItem(fullPath), fullPath);
+        }
+
+        if (filterFiles && matches(name) && !isIndexed(fullPath)) {
+            CatItem item(fullPath);
+            g_app->alterItem(&item);
+#ifdef Q_OS_LINUX
+            if (item.fullPath.endsWith(".desktop") && item.iconPath.isEmpty()) {
+                return;
+            }
+#endif
+            // Another task may have taken the file meanwhile
+            if (claim(fullPath)) {
+                add(item, fullPath);
+            }
+        }
+    });
+
+    return dir;
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <QList>
+#include <QRegularExpression>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include "CatalogItem.h"
+#include "Directory.h"
+
+namespace launchy {
+
+class DirectoryIndexer;
+
+// DirectoryScanner lists the directories of one catalog directory. Every
+// directory is read in a single pass, on Unix with readdir and the entry
+// types it reports, so that only symbolic links and unknown types cost a stat.
+// The type filters are compiled once, plain "*.suffix" filters into a set
+// of lower case suffixes and the others into wildcard expressions.
+// The tasks of a catalog directory share its scanner, so scan() only reads it.
+class DirectoryScanner {
+public:
+    DirectoryScanner();
+    explicit DirectoryScanner(const Directory& directory);
+
+    const Directory& directory() const;
+
+    // List the items of one directory the way a build does, and the
+    // subdirectories to descend into when depth is above 0, return the
+    // absolute path of the directory. Every path is claimed on indexer
+    // first when it is not null, so that it is added only once. When sources
+    // is not null it receives the path each item was claimed as, or an empty
+    // one for the items which are not claimed
+    QString scan(const QString& path, int depth, QList<CatItem>& items,
+                 QStringList& subdirectories, DirectoryIndexer* indexer = nullptr,
+                 QStringList* sources = nullptr) const;
+
+    // Whether a file name passes the type filters, case insensitively
+    bool matches(const QString& name) const;
+
+private:
+    Directory m_directory;
+    bool m_matchAll;
+    QSet<QString> m_suffixes;
+    // Matching with a const QRegularExpression is thread safe
+    QVector<QRegularExpression> m_patterns;
+};
+
+inline const Directory& DirectoryScanner::directory() const {
+    return m_directory;
+}
+
+}
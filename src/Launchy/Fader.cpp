@@ -20,7 +20,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "Precompiled.h"
 #include "Fader.h"
 #include "LaunchyLib.h"
-#include "OptionItem.h"
+#include "SettingsSnapshot.h"
 
 namespace launchy {
 Fader::Fader(QObject* parent)
@@ -34,10 +34,11 @@ Fader::~Fader() {
 }
 
 void Fader::fadeIn(bool quick) {
-    int time = g_settings->value(OPSTION_FADEIN, OPSTION_FADEIN_DEFAULT).toInt();
+    SettingsSnapshotPtr settings = SettingsSnapshot::current();
+    int time = settings->fadeIn;
 
     m_mutex.lock();
-    m_targetLevel = g_settings->value(OPSTION_OPAQUENESS, OPSTION_OPAQUENESS_DEFAULT).toInt() / 100.0;
+    m_targetLevel = settings->opaqueness / 100.0;
     m_delta = 0.05;
     m_delay = quick ? 0 : (int)(time * m_delta / m_targetLevel);
     if (m_delay > 10) {
@@ -60,8 +61,9 @@ void Fader::fadeIn(bool quick) {
 
 
 void Fader::fadeOut(bool quick) {
-    int time = g_settings->value(OPSTION_FADEOUT, OPSTION_FADEOUT_DEFAULT).toInt();
-    double opaqueness = g_settings->value(OPSTION_OPAQUENESS, OPSTION_OPAQUENESS_DEFAULT).toInt() / 100.0;
+    SettingsSnapshotPtr settings = SettingsSnapshot::current();
+    int time = settings->fadeOut;
+    double opaqueness = settings->opaqueness / 100.0;
 
     m_mutex.lock();
     m_targetLevel = 0;
@@ -0,0 +1,101 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "FuzzyPattern.h"
+#include <algorithm>
+
+namespace launchy {
+
+// Longest query the 64-bit masks can hold
+static const int MAX_FUZZY_QUERY_LENGTH = 64;
+// Query characters per tolerated typo
+static const int FUZZY_CHARS_PER_EDIT = 4;
+
+FuzzyPattern::FuzzyPattern(const QString& query, int maxEdits)
+    : m_length(0),
+      m_maxEdits(maxEdits),
+      m_used(0) {
+    std::fill(m_latin1, m_latin1 + 256, 0);
+
+    if (query.isEmpty() || query.size() > MAX_FUZZY_QUERY_LENGTH) {
+        return;
+    }
+
+    m_length = query.size();
+    m_used = m_length == 64 ? ~Q_UINT64_C(0) : (Q_UINT64_C(1) << m_length) - 1;
+
+    for (int i = 0; i < m_length; ++i) {
+        ushort c = query[i].unicode();
+        quint64 bit = Q_UINT64_C(1) << i;
+        if (c < 256) {
+            m_latin1[c] |= bit;
+            continue;
+        }
+
+        bool found = false;
+        for (int j = 0; j < m_others.size(); ++j) {
+            if (m_others[j].first == c) {
+                m_others[j].second |= bit;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            m_others.push_back(qMakePair(c, bit));
+        }
+    }
+}
+
+inline quint64 FuzzyPattern::mask(ushort c) const {
+    if (c < 256) {
+        return m_latin1[c];
+    }
+    for (int j = 0; j < m_others.size(); ++j) {
+        if (m_others[j].first == c) {
+            return m_others[j].second;
+        }
+    }
+    return 0;
+}
+
+// Bit i of v is cleared once query character i is part of the longest
+// common subsequence, so the set bits count the dropped query characters
+int FuzzyPattern::distance(const ushort* name, int length) const {
+    if (!isValid()) {
+        return MAX_FUZZY_QUERY_LENGTH + 1;
+    }
+
+    quint64 v = m_used;
+    for (int i = 0; i < length; ++i) {
+        quint64 pm = mask(name[i]);
+        if (pm) {
+            quint64 u = v & pm;
+            v = ((v + u) | (v - u)) & m_used;
+        }
+    }
+    return qPopulationCount(v);
+}
+
+int FuzzyPattern::editsFor(const QString& query, int budget) {
+    if (budget <= 0 || query.size() > MAX_FUZZY_QUERY_LENGTH) {
+        return 0;
+    }
+    return qMin(budget, query.size() / FUZZY_CHARS_PER_EDIT);
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <QPair>
+
+namespace launchy {
+
+// FuzzyPattern matches a query approximately against packed search names.
+// The distance of a name is the number of query characters which have to be
+// dropped for the rest to be an in-order subsequence of the name, so a
+// distance of 0 is exactly a Catalog::matches match. It is computed with the
+// bit-parallel LCS recurrence over one 64-bit mask, one step per name
+// character, so queries are limited to 64 characters.
+class FuzzyPattern {
+public:
+    FuzzyPattern(const QString& query, int maxEdits);
+
+    bool isValid() const;
+    int maxEdits() const;
+
+    int distance(const ushort* name, int length) const;
+    bool matches(const ushort* name, int length) const;
+
+    // Number of typos tolerated for a query with the given edit budget,
+    // short queries get fewer so they don't match nearly everything
+    static int editsFor(const QString& query, int budget);
+
+private:
+    quint64 mask(ushort c) const;
+
+private:
+    int m_length;
+    int m_maxEdits;
+    quint64 m_used;
+    // Positions of every query character, Latin-1 ones by direct lookup
+    quint64 m_latin1[256];
+    QVector<QPair<ushort, quint64>> m_others;
+};
+
+inline bool FuzzyPattern::isValid() const {
+    return m_length > 0;
+}
+
+inline int FuzzyPattern::maxEdits() const {
+    return m_maxEdits;
+}
+
+inline bool FuzzyPattern::matches(const ushort* name, int length) const {
+    return length >= m_length - m_maxEdits && distance(name, length) <= m_maxEdits;
+}
+
+}
@@ -4,7 +4,7 @@ win32:TARGET = Launchy
 unix:!macx:TARGET = launchy
 macx:TARGET = Launchy
 
-QT += network widgets
+QT += network widgets concurrent
 
 CONFIG += debug_and_release
 # CONFIG += qt release
@@ -16,6 +16,16 @@ SOURCES = main.cpp \
           OptionDialog.cpp \
           Catalog.cpp \
           CatalogBuilder.cpp \
+          SearchSession.cpp \
+          SearchWorker.cpp \
+          SubsequenceMatcher.cpp \
+          CatalogColumns.cpp \
+          CatalogImage.cpp \
+          CatalogJournal.cpp \
+          CatalogWatcher.cpp \
+          StringPool.cpp \
+          CatalogSnapshot.cpp \
+          FuzzyPattern.cpp \
           PluginHandler.cpp \
           IconDelegate.cpp \
           IconExtractor.cpp \
@@ -27,13 +37,17 @@ SOURCES = main.cpp \
           CharListWidget.cpp \
           CharLineEdit.cpp \
           CommandHistory.cpp \
+          RecentChoices.cpp \
           InputDataList.cpp \
           FileSearch.cpp \
           AnimationLabel.cpp \
           SettingsManager.cpp \
+          SettingsSnapshot.cpp \
           Logger.cpp \
           OptionItem.cpp \
           Directory.cpp \
+          DirectoryIndexer.cpp \
+          DirectoryScanner.cpp \
           UpdateChecker.cpp \
           TranslationManager.cpp
 
@@ -42,6 +56,17 @@ HEADERS = AppBase.h \
           LaunchyWidget.h \
           Catalog.h \
           CatalogBuilder.h \
+          SearchSession.h \
+          SearchControl.h \
+          SearchWorker.h \
+          SubsequenceMatcher.h \
+          CatalogColumns.h \
+          CatalogImage.h \
+          CatalogJournal.h \
+          CatalogWatcher.h \
+          StringPool.h \
+          CatalogSnapshot.h \
+          FuzzyPattern.h \
           PluginHandler.h \
           OptionDialog.h \
           IconDelegate.h \
@@ -54,13 +79,17 @@ HEADERS = AppBase.h \
           CharLineEdit.h \
           Fader.h \
           CommandHistory.h \
+          RecentChoices.h \
           InputDataList.h \
           FileSearch.h \
           AnimationLabel.h \
           SettingsManager.h \
+          SettingsSnapshot.h \
           Logger.h \
           OptionItem.h \
           Directory.h \
+          DirectoryIndexer.h \
+          DirectoryScanner.h \
           UpdateChecker.h \
           TranslationManager.h
 
@@ -70,6 +99,10 @@ RESOURCES += launchy.qrc
 
 include(../../deps/SingleApplication/singleapplication.pri)
 DEFINES += QAPPLICATION_CLASS=QApplication
+
+# qmake CONFIG+=check_matcher checks the packed subsequence matcher
+# against Catalog::matches on random names when the catalog is created
+check_matcher:DEFINES += LAUNCHY_CHECK_MATCHER
 include(../../deps/QHotkey/QHotkey.pri)
 
 PRECOMPILED_HEADER  = Precompiled.h
@@ -24,6 +24,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include <QMenu>
 #include <QSystemTrayIcon>
 #include <QPushButton>
+#include <QtConcurrent>
 #include "QHotkey/QHotkey.h"
 #include "GlobalVar.h"
 #include "IconDelegate.h"
@@ -31,6 +32,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "OptionItem.h"
 #include "FileSearch.h"
 #include "SettingsManager.h"
+#include "SettingsSnapshot.h"
 #include "AppBase.h"
 #include "Fader.h"
 #include "IconDelegate.h"
@@ -41,6 +43,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "CatalogBuilder.h"
 #include "PluginInterface.h"
 #include "PluginHandler.h"
+#include "SearchWorker.h"
 #include "PluginMsg.h"
 #include "UpdateChecker.h"
 
@@ -71,12 +74,20 @@ LaunchyWidget::LaunchyWidget(CommandFlags command)
       m_pHotKey(new QHotkey(this)),
       m_rebuildTimer(new QTimer(this)),
       m_dropTimer(new QTimer(this)),
+      m_deferredCommand(Default),
+      m_catalogLoaded(false),
+      m_pluginsLoaded(false),
+      m_buildPending(false),
+      m_refreshPending(false),
+      m_searchWorker(new SearchWorker(this)),
+      m_pluginSearchPending(false),
       m_alwaysShowLaunchy(false),
       m_dragging(false),
       m_menuOpen(false),
       m_optionDialog(nullptr),
       m_optionsOpen(false) {
 
+    m_startupTimer.start();
     g_searchText.clear();
 
     setObjectName("launchy");
@@ -118,6 +129,12 @@ LaunchyWidget::LaunchyWidget(CommandFlags command)
     connect(m_alternativeList, SIGNAL(currentRowChanged(int)), this, SLOT(onAlternativeListRowChanged(int)));
     connect(m_alternativeList, SIGNAL(keyPressed(QKeyEvent*)), this, SLOT(onAlternativeListKeyPressed(QKeyEvent*)));
     connect(m_alternativeList, SIGNAL(focusOut()), this, SLOT(onAlternativeListFocusOut()));
+    connect(m_alternativeList, SIGNAL(endReached()), this, SLOT(onAlternativeListEndReached()));
+
+    connect(m_searchWorker, SIGNAL(prefixSearched(QString, QList<CatItem>)),
+            this, SLOT(onCatalogPrefixSearched(QString, QList<CatItem>)));
+    connect(m_searchWorker, SIGNAL(searched(QString, QList<CatItem>)),
+            this, SLOT(onCatalogSearched(QString, QList<CatItem>)));
 
     m_optionButton->setObjectName("opsButton");
     m_optionButton->setToolTip(tr("Options"));
@@ -159,16 +176,19 @@ LaunchyWidget::LaunchyWidget(CommandFlags command)
         command = ShowLaunchy | ShowOptions;
     }
 
-    // Load the catalog
+    // Load the catalog in the background, searches run against
+    // the items loaded so far until it is done
     connect(g_builder, SIGNAL(catalogIncrement(int)), this, SLOT(catalogProgressUpdated(int)));
     connect(g_builder, SIGNAL(catalogFinished()), this, SLOT(catalogBuilt()));
-
-    if (!g_catalog->load(SettingsManager::instance().catalogFilename())) {
-        command |= Rescan;
-    }
+    connect(&m_catalogLoader, SIGNAL(finished()), this, SLOT(onCatalogLoaded()));
+    m_catalogLoader.setFuture(QtConcurrent::run(g_catalog, &Catalog::load,
+                                                SettingsManager::instance().catalogFilename()));
 
     // Load the history
     m_history.load(SettingsManager::instance().historyFilename());
+    if (!g_catalog->recentChoices().load(SettingsManager::instance().choicesFilename())) {
+        g_catalog->recentChoices().importSettings(SettingsManager::instance().choicesFilename());
+    }
 
     // Load fail-safe basic skin
     QFile basicSkinFile(":/resources/basicskin.qss");
@@ -180,6 +200,11 @@ LaunchyWidget::LaunchyWidget(CommandFlags command)
     // Move to saved position
     loadPosition(g_settings->value(OPSTION_POS, OPSTION_POS_DEFAULT).toPoint());
 
+    // Still loading, the skin has to be applied first
+    if (m_catalogLoader.isRunning()) {
+        m_workingAnimation->Start();
+    }
+
     connect(g_app, &SingleApplication::instanceStarted,
             this, &LaunchyWidget::onSecondInstance);
 
@@ -194,14 +219,20 @@ LaunchyWidget::LaunchyWidget(CommandFlags command)
     // start update checker
     UpdateChecker::instance().startup();
 
-    // Load the plugins
-    PluginHandler::instance().loadPlugins();
+    // The window is shown right away, the plugins are loaded once the event
+    // loop runs and the other commands may need them
+    executeStartupCommand(command & (ResetPosition | ResetSkin | ShowLaunchy));
+    m_deferredCommand = command & ~(ResetPosition | ResetSkin | ShowLaunchy);
+    QTimer::singleShot(0, this, SLOT(onStartupDeferred()));
 
-    executeStartupCommand(command);
+    qInfo() << "LaunchyWidget::LaunchyWidget, searches usable after"
+        << m_startupTimer.elapsed() << "ms";
 }
 
 LaunchyWidget::~LaunchyWidget() {
     s_instance = nullptr;
+    // The catalog must outlive its loader
+    m_catalogLoader.waitForFinished();
     m_trayIcon->hide();
     if (m_optionDialog) {
         m_optionDialog->close();
@@ -326,7 +357,17 @@ void LaunchyWidget::showTrayIcon() {
 // Repopulate the alternatives list with the current search results
 // and set its size and position accordingly.
 void LaunchyWidget::updateAlternativeList(bool resetSelection) {
-    int mode = g_settings->value(OPSTION_CONDENSEDVIEW, OPSTION_CONDENSEDVIEW_DEFAULT).toInt();
+    int mode = SettingsSnapshot::current()->condensedView;
+
+    // Results merged in by a later search stage may move the selected item,
+    // remember it so that the selection follows it
+    QString selectedPath;
+    QListWidgetItem* selected = m_alternativeList->currentItem();
+    if (!resetSelection && selected) {
+        selectedPath = selected->data(mode == 1 ? ROLE_SHORT : ROLE_FULL).toString();
+    }
+    int selectedRow = -1;
+
     int i = 0;
     for (; i < m_searchResult.size(); ++i) {
         qDebug() << "LaunchyWidget::updateAlternativeList," << i << ":"
@@ -352,6 +393,9 @@ void LaunchyWidget::updateAlternativeList(bool resetSelection) {
         item->setData(mode == 1 ? ROLE_SHORT : ROLE_FULL, fullPath);
         if (i >= m_alternativeList->count())
             m_alternativeList->addItem(item);
+        if (selectedRow == -1 && !selectedPath.isEmpty() && fullPath == selectedPath) {
+            selectedRow = i;
+        }
     }
 
     while (m_alternativeList->count() > i) {
@@ -361,6 +405,9 @@ void LaunchyWidget::updateAlternativeList(bool resetSelection) {
     if (resetSelection) {
         m_alternativeList->setCurrentRow(0);
     }
+    else if (selectedRow != -1 && selectedRow != m_alternativeList->currentRow()) {
+        m_alternativeList->setCurrentRow(selectedRow);
+    }
     m_iconExtractor.processIcons(m_searchResult);
 
     m_alternativeList->updateGeometry(pos(), m_inputBox->pos());
@@ -571,10 +618,13 @@ void LaunchyWidget::onAlternativeListKeyPressed(QKeyEvent* event) {
         if (!m_searchResult.isEmpty()) {
             int row = m_alternativeList->currentRow();
             if (row > -1) {
-                QString location = "History/" + m_inputBox->text();
-                QStringList hist;
-                hist << m_searchResult[row].shortName << m_searchResult[row].fullPath;
-                g_settings->setValue(location, hist);
+                // The choice was made on the rows shown, a pending search must not replace them
+                cancelSearch();
+
+                // Saved right away, the settings used to keep them did so too
+                if (g_catalog->recentChoices().setChoice(m_inputBox->text(), m_searchResult[row])) {
+                    g_catalog->recentChoices().save(SettingsManager::instance().choicesFilename());
+                }
 
                 if (row > 0) {
                     m_searchResult.move(row, 0);
@@ -649,6 +699,25 @@ void LaunchyWidget::onAlternativeListFocusOut() {
     }
 }
 
+// Only the first page of catalog results is ranked by a search,
+// rank and append the next page once the end of the list is reached
+void LaunchyWidget::onAlternativeListEndReached() {
+    if (!m_alternativeList->isVisible()
+        || m_inputData.count() != 1
+        || m_inputData.first().hasLabel(LABEL_HISTORY)
+        || m_inputBox->text().isEmpty()) {
+        return;
+    }
+
+    int count = SettingsSnapshot::current()->numResult;
+    QList<CatItem> more;
+    if (g_catalog->searchMore(g_searchText, count, more) && !more.isEmpty()) {
+        qDebug() << "LaunchyWidget::onAlternativeListEndReached, append" << more.count() << "results";
+        m_searchResult.append(more);
+        updateAlternativeList(false);
+    }
+}
+
 void LaunchyWidget::keyPressEvent(QKeyEvent* event) {
     if (!event || !m_alternativeList || !m_inputBox) {
         qWarning("LaunchyWidget::keyPressEvent, pointer is null");
@@ -758,6 +827,7 @@ void LaunchyWidget::doBackTab() {
 }
 
 void LaunchyWidget::doTab() {
+    flushSearch();
     if (!m_inputData.isEmpty() && !m_searchResult.isEmpty()) {
         // If it's an incomplete file or directory, complete it
         QFileInfo info(m_searchResult.first().fullPath);
@@ -789,6 +859,8 @@ void LaunchyWidget::doTab() {
 
 
 void LaunchyWidget::doEnter() {
+    // Launch what the newest search found
+    flushSearch();
     hideAlternativeList();
 
     if ((!m_inputData.isEmpty() && !m_searchResult.isEmpty())
@@ -805,8 +877,66 @@ void LaunchyWidget::processInput() {
     qDebug() << "LaunchyWidget::processInput, inputbox text:" << m_inputBox->text();
 
     m_inputData.parse(m_inputBox->text());
+
+    // Plain catalog searches run in the background, so typing never waits
+    // for them, their results are shown stage by stage as they arrive:
+    // the items starting with the text, every catalog and history match,
+    // then the plugin results
+    if (isCatalogSearch()) {
+        m_pluginSearchPending = false;
+        g_searchText = m_inputData.last().getText().toLower();
+        m_searchWorker->search(g_searchText);
+        return;
+    }
+
     searchOnInput();
-    updateOutput();
+    showSearchResult();
+}
+
+void LaunchyWidget::onCatalogPrefixSearched(const QString& text, const QList<CatItem>& result) {
+    if (!isCurrentSearch(text)) {
+        return;
+    }
+
+    // First results of the new text, the selection starts over
+    m_searchResult = result;
+    if (!m_searchResult.isEmpty()) {
+        m_inputData.last().setTopResult(m_searchResult[0]);
+    }
+    showSearchResult(true);
+}
+
+void LaunchyWidget::onCatalogSearched(const QString& text, const QList<CatItem>& result) {
+    if (!isCurrentSearch(text)) {
+        qDebug() << "LaunchyWidget::onCatalogSearched, input changed, dropped results for" << text;
+        return;
+    }
+
+    searchHistory(result);
+    showSearchResult(false);
+
+    // Let the catalog matches be painted before the plugins are asked
+    m_pluginSearchPending = true;
+    QTimer::singleShot(0, this, SLOT(onPluginSearchDue()));
+}
+
+void LaunchyWidget::onPluginSearchDue() {
+    if (!m_pluginSearchPending) {
+        return;
+    }
+    m_pluginSearchPending = false;
+
+    searchPlugins();
+    showSearchResult(false);
+}
+
+// The input may have been changed without a new search, e.g. by the alternatives list
+bool LaunchyWidget::isCurrentSearch(const QString& text) const {
+    return isCatalogSearch() && m_inputData.last().getText().toLower() == text;
+}
+
+void LaunchyWidget::showSearchResult(bool resetSelection) {
+    updateOutput(resetSelection);
 
     // If there is no input text, ensure that the alternatives list is hidden
     // otherwise, show it after the user defined delay if it's not currently visible
@@ -818,7 +948,45 @@ void LaunchyWidget::processInput() {
     }
 }
 
+// Only the catalog stage of a single part, non history input
+// can run in the background
+bool LaunchyWidget::isCatalogSearch() const {
+    return m_inputData.count() == 1
+        && !m_inputData.first().hasLabel(LABEL_HISTORY)
+        && !m_inputBox->text().isEmpty();
+}
+
+// Drop the background search, none of its stages will be shown
+void LaunchyWidget::cancelSearch() {
+    m_searchWorker->cancel();
+    m_pluginSearchPending = false;
+}
+
+// Run the remaining stages of the background search right away
+void LaunchyWidget::flushSearch() {
+    m_searchWorker->flush();
+    onPluginSearchDue();
+}
+
+// Search synchronously, replacing any search running in the background
 void LaunchyWidget::searchOnInput() {
+    cancelSearch();
+
+    QList<CatItem> catalogResult;
+    if (isCatalogSearch()) {
+        QString searchTextLower = m_inputData.last().getText().toLower();
+        qDebug() << "LaunchyWidget::searchOnInput, searching catalog for" << searchTextLower;
+        int budget = SettingsSnapshot::current()->searchStageBudget;
+        SearchControl control(nullptr, 0, budget);
+        g_catalog->searchCatalogs(searchTextLower, catalogResult, &control);
+    }
+    searchHistory(catalogResult);
+    searchPlugins();
+}
+
+// Merge the history matches into the catalog results, the stages following
+// the catalog search run on the GUI thread, plugins may use objects which live there
+void LaunchyWidget::searchHistory(const QList<CatItem>& catalogResult) {
     QString searchText = m_inputData.isEmpty() ? "" : m_inputData.last().getText();
     QString searchTextLower = searchText.toLower();
     g_searchText = searchTextLower;
@@ -827,41 +995,81 @@ void LaunchyWidget::searchOnInput() {
     if ((!m_inputData.isEmpty() && m_inputData.first().hasLabel(LABEL_HISTORY))
         || m_inputBox->text().isEmpty()) {
         // Add history items exclusively and unsorted so they remain in most recently used order
-        qDebug() << "LaunchyWidget::searchOnInput, get all history items";
+        qDebug() << "LaunchyWidget::searchHistory, get all history items";
         m_history.getAllItem(m_searchResult);
+        return;
     }
-    else {
-        // Search the catalog for matching items
-        if (m_inputData.count() == 1) {
-            qDebug() << "LaunchyWidget::searchOnInput, searching catalog for" << searchText;
-            g_catalog->searchCatalogs(searchTextLower, m_searchResult);
 
-            qDebug() << "LaunchyWidget::searchOnInput, searching history for" << searchText;
-            m_history.search(searchTextLower, m_searchResult);
-        }
+    QElapsedTimer timer;
+    timer.start();
 
-        // Give plugins a chance to add their own dynamic matches
-        // why getLabels first then getResults, why not getResult straightforward
-        PluginHandler& pluginHandler = PluginHandler::instance();
-        pluginHandler.getLabels(&m_inputData);
-        pluginHandler.getResults(&m_inputData, &m_searchResult);
+    m_searchResult = catalogResult;
+    if (m_inputData.count() == 1) {
+        qDebug() << "LaunchyWidget::searchHistory, searching history for" << searchText;
+        m_history.search(searchTextLower, m_searchResult);
+    }
 
-        // Sort the results by match and usage, then promote any that match previously
-        // executed commands
-        qSort(m_searchResult.begin(), m_searchResult.end(), CatLessRef);
-        g_catalog->promoteRecentlyUsedItems(searchTextLower, m_searchResult);
+    // Sort the results by match and usage, then promote any that match previously
+    // executed commands
+    qSort(m_searchResult.begin(), m_searchResult.end(), CatLessRef);
+    g_catalog->promoteRecentlyUsedItems(searchTextLower, m_searchResult);
 
-        if (!m_searchResult.isEmpty()) {
-            m_inputData.last().setTopResult(m_searchResult[0]);
-        }
+    if (!m_searchResult.isEmpty()) {
+        m_inputData.last().setTopResult(m_searchResult[0]);
+    }
 
-        // Finally, if the search text looks like a file or directory name,
-        // add any file or directory matches
-        if (searchText.contains(QDir::separator())
-            || searchText.startsWith("~")
-            || (searchText.size() == 2 && searchText[0].isLetter() && searchText[1] == ':')) {
-            FileSearch::search(searchText, m_searchResult, m_inputData);
-        }
+    int budget = SettingsSnapshot::current()->searchStageBudget;
+    qint64 historyTime = timer.elapsed();
+    qDebug() << "LaunchyWidget::searchHistory, stage time(ms):" << historyTime;
+    if (budget > 0 && historyTime > budget) {
+        qWarning() << "LaunchyWidget::searchHistory, history stage exceeded its"
+            << budget << "ms budget";
+    }
+}
+
+// Add the plugin and file matches to the results of searchHistory
+void LaunchyWidget::searchPlugins() {
+    if ((!m_inputData.isEmpty() && m_inputData.first().hasLabel(LABEL_HISTORY))
+        || m_inputBox->text().isEmpty()) {
+        return;
+    }
+
+    QString searchText = m_inputData.last().getText();
+    QString searchTextLower = searchText.toLower();
+
+    int budget = SettingsSnapshot::current()->searchStageBudget;
+    QElapsedTimer timer;
+    timer.start();
+
+    // Give plugins a chance to add their own dynamic matches
+    // why getLabels first then getResults, why not getResult straightforward
+    PluginHandler& pluginHandler = PluginHandler::instance();
+    pluginHandler.getLabels(&m_inputData);
+    pluginHandler.getResults(&m_inputData, &m_searchResult, budget);
+    qint64 pluginTime = timer.restart();
+
+    // Plugin results take their place among the sorted ones
+    qSort(m_searchResult.begin(), m_searchResult.end(), CatLessRef);
+    g_catalog->promoteRecentlyUsedItems(searchTextLower, m_searchResult);
+
+    if (!m_searchResult.isEmpty()) {
+        m_inputData.last().setTopResult(m_searchResult[0]);
+    }
+
+    // Finally, if the search text looks like a file or directory name,
+    // add any file or directory matches
+    if (searchText.contains(QDir::separator())
+        || searchText.startsWith("~")
+        || (searchText.size() == 2 && searchText[0].isLetter() && searchText[1] == ':')) {
+        FileSearch::search(searchText, m_searchResult, m_inputData);
+    }
+    qint64 fileTime = timer.elapsed();
+
+    qDebug() << "LaunchyWidget::searchPlugins, stage times(ms) plugins:" << pluginTime
+        << "files:" << fileTime;
+    if (budget > 0 && fileTime > budget) {
+        qWarning() << "LaunchyWidget::searchPlugins, file stage exceeded its"
+            << budget << "ms budget";
     }
 }
 
@@ -907,7 +1115,7 @@ void LaunchyWidget::updateOutputItem(const CatItem& item) {
 }
 
 void LaunchyWidget::startDropTimer() {
-    int delay = g_settings->value(OPSTION_AUTOSUGGESTDELAY, OPSTION_AUTOSUGGESTDELAY_DEFAULT).toInt();
+    int delay = SettingsSnapshot::current()->autoSuggestDelay;
     if (delay > 0) {
         m_dropTimer->start(delay);
         qDebug() << "LaunchyWidget::startDropTimer, timer start, delay =" << delay;
@@ -979,6 +1187,60 @@ void LaunchyWidget::catalogProgressUpdated(int value) {
     }
 }
 
+void LaunchyWidget::onStartupDeferred() {
+    // Load the plugins
+    PluginHandler::instance().loadPlugins();
+    m_pluginsLoaded = true;
+    qInfo() << "LaunchyWidget::onStartupDeferred, plugins loaded after"
+        << m_startupTimer.elapsed() << "ms";
+
+    // The catalog may have loaded before the event loop got here
+    startPendingBuild();
+
+    executeStartupCommand(m_deferredCommand);
+    m_deferredCommand = Default;
+}
+
+void LaunchyWidget::onCatalogLoaded() {
+    m_workingAnimation->Stop();
+    qInfo() << "LaunchyWidget::onCatalogLoaded, catalog of" << g_catalog->count()
+        << "items loaded after" << m_startupTimer.elapsed() << "ms";
+
+    // Fold the replayed journal into a new image,
+    // a catalog which could not be loaded is refreshed.
+    // While watching, a loaded catalog is refreshed once for the changes made
+    // while Launchy was not running, which gives the watcher its directories
+    g_catalog->compact(SettingsManager::instance().catalogFilename());
+    bool watch = g_settings->value(OPTION_CATALOG_WATCH, OPTION_CATALOG_WATCH_DEFAULT).toBool();
+    m_catalogLoaded = true;
+    if (!m_catalogLoader.result() || watch) {
+        m_refreshPending = true;
+    }
+    startPendingBuild();
+
+    // Show the results of a search typed while loading against the whole catalog
+    if (isVisible() && !m_inputBox->text().isEmpty()) {
+        processInput();
+    }
+}
+
+// The builder reads the plugins, so no build starts before they are loaded
+void LaunchyWidget::startPendingBuild() {
+    if (!m_catalogLoaded || !m_pluginsLoaded) {
+        return;
+    }
+
+    if (m_buildPending) {
+        m_buildPending = false;
+        m_refreshPending = false;
+        buildCatalog();
+    }
+    else if (m_refreshPending) {
+        m_refreshPending = false;
+        buildCatalog(true);
+    }
+}
+
 void LaunchyWidget::catalogBuilt() {
     // Save settings and updated catalog, stop the "working" animation
     saveSettings();
@@ -1050,12 +1312,23 @@ void LaunchyWidget::saveSettings() {
     qDebug() << "LaunchyWidget::saveSettings";
     savePosition();
     g_settings->sync();
-    g_catalog->save(SettingsManager::instance().catalogFilename());
+    // The changes are already in the journal, the image is rewritten in the background,
+    // an image written while the catalog loads would miss items
+    if (!m_catalogLoader.isRunning()) {
+        g_catalog->compact(SettingsManager::instance().catalogFilename());
+    }
     m_history.save(SettingsManager::instance().historyFilename());
+    g_catalog->recentChoices().save(SettingsManager::instance().choicesFilename());
 }
 
 void LaunchyWidget::startRebuildTimer() {
     int time = g_settings->value(OPTION_REBUILDTIMER, OPTION_REBUILDTIMER_DEFAULT).toInt();
+    // The watcher keeps the catalog current, a full rebuild is only a rare
+    // sweep for what it missed
+    if (g_settings->value(OPTION_CATALOG_WATCH, OPTION_CATALOG_WATCH_DEFAULT).toBool()) {
+        time = g_settings->value(OPTION_CATALOG_SWEEPINTERVAL,
+                                 OPTION_CATALOG_SWEEPINTERVAL_DEFAULT).toInt();
+    }
     if (time > 0) {
         m_rebuildTimer->start(time * 60000);
     }
@@ -1134,7 +1407,10 @@ void LaunchyWidget::reloadSkin() {
 void LaunchyWidget::exit() {
     m_trayIcon->hide();
     m_fader->stop();
+    m_catalogLoader.waitForFinished();
     saveSettings();
+    // Wait for the catalog image to be written
+    g_catalog->save(SettingsManager::instance().catalogFilename());
     qApp->quit();
 }
 
@@ -1323,13 +1599,27 @@ void LaunchyWidget::trayIconActivated(QSystemTrayIcon::ActivationReason reason)
     }
 }
 
-void LaunchyWidget::buildCatalog() {
+// The rebuild timer, the rebuild command and the options ask for a full
+// build, which is the only one seeing changes within files
+void LaunchyWidget::buildCatalog(bool refresh) {
+    // The builder would race the loader or the plugins loading,
+    // it runs once both are done
+    if (!m_catalogLoaded || !m_pluginsLoaded) {
+        if (refresh) {
+            m_refreshPending = true;
+        }
+        else {
+            m_buildPending = true;
+        }
+        return;
+    }
+
     m_rebuildTimer->stop();
     saveSettings();
 
     // Use the catalog builder to refresh the catalog in a worker thread
     // QMetaObject::invokeMethod(g_builder, &CatalogBuilder::buildCatalog);
-	QMetaObject::invokeMethod(g_builder, "buildCatalog");
+    QMetaObject::invokeMethod(g_builder, refresh ? "refreshCatalog" : "buildCatalog");
 
     startRebuildTimer();
 }
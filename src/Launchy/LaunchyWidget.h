@@ -20,6 +20,8 @@
 #pragma once
 
 #include <QWidget>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
 #include "CatalogItem.h"
 #include "IconExtractor.h"
 #include "InputData.h"
@@ -36,6 +38,7 @@ class IconDelegate;
 class CharListWidget;
 class CharLineEdit;
 class OptionDialog;
+class SearchWorker;
 
 enum CommandFlag {
     Default         = 0,
@@ -70,7 +73,8 @@ public:
 
 public slots:
     void showLaunchy(bool noFade = false);
-    void buildCatalog();
+    // A refresh does not list the directories unchanged since the last build
+    void buildCatalog(bool refresh = false);
     void setOpaqueness(int level);
 
 protected:
@@ -114,10 +118,19 @@ protected:
     void doBackTab();
     void doEnter();
     void processInput();
+    void showSearchResult(bool resetSelection = true);
+    bool isCatalogSearch() const;
+    bool isCurrentSearch(const QString& text) const;
     void searchOnInput();
+    void cancelSearch();
+    void flushSearch();
+    void searchHistory(const QList<CatItem>& catalogResult);
+    void searchPlugins();
     void launchItem();
     void startDropTimer();
     void retranslateUi();
+    // Start the build asked for during startup once nothing races it
+    void startPendingBuild();
 
 protected slots:
     void showOptionDialog();
@@ -125,6 +138,8 @@ protected slots:
     void dropTimeout();
     void catalogProgressUpdated(int);
     void catalogBuilt();
+    void onCatalogLoaded();
+    void onStartupDeferred();
     void setFadeLevel(double level);
     void iconExtracted(int index, const QString& path, const QIcon& icon);
     void trayIconActivated(QSystemTrayIcon::ActivationReason reason);
@@ -133,6 +148,10 @@ protected slots:
     void onAlternativeListRowChanged(int index);
     void onAlternativeListKeyPressed(QKeyEvent* event);
     void onAlternativeListFocusOut();
+    void onAlternativeListEndReached();
+    void onCatalogPrefixSearched(const QString& text, const QList<CatItem>& result);
+    void onCatalogSearched(const QString& text, const QList<CatItem>& result);
+    void onPluginSearchDue();
     void onInputBoxKeyPressed(QKeyEvent* event);
     void onInputBoxFocusOut();
     void onInputBoxInputMethod(QInputMethodEvent* event);
@@ -167,11 +186,27 @@ protected:
     QTimer* m_rebuildTimer;
     QTimer* m_dropTimer;
 
+    // Startup is staged, the window and the hotkey are live first while
+    // the catalog loads in the background and the plugins load afterwards
+    QElapsedTimer m_startupTimer;
+    QFutureWatcher<bool> m_catalogLoader;
+    // Startup commands run once the plugins are loaded
+    int m_deferredCommand;
+    // Builds wait until the catalog is loaded and the plugins are,
+    // a full build asked for meanwhile wins over the refresh after loading
+    bool m_catalogLoaded;
+    bool m_pluginsLoaded;
+    bool m_buildPending;
+    bool m_refreshPending;
+
     IconExtractor m_iconExtractor;
 
     InputDataList m_inputData;
     CommandHistory m_history;
     QList<CatItem> m_searchResult;
+    SearchWorker* m_searchWorker;
+    // The plugins stage of the last background search has not run yet
+    bool m_pluginSearchPending;
     CatItem m_outputItem;
     bool m_alwaysShowLaunchy;
 
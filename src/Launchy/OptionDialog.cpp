@@ -26,6 +26,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "PluginHandler.h"
 #include "FileBrowserDelegate.h"
 #include "SettingsManager.h"
+#include "SettingsSnapshot.h"
 #include "Logger.h"
 #include "Catalog.h"
 #include "CatalogBuilder.h"
@@ -123,7 +124,9 @@ void OptionDialog::accept() {
 
     saveSystemSettings();
 
+    // Write the whole change set at once, then let the hot paths see it
     g_settings->sync();
+    SettingsSnapshot::refresh();
 
     if (!bSuccess) {
         return;
@@ -136,4 +136,44 @@ const char*     OPTION_PROXY_PASSWORD_DEFAULT                  = "";
 const char*     OPTION_LANGUAGE                                = "System/Language";
 const char*     OPTION_LANGUAGE_DEFAULT                        = "";
 
+// Catalog
+// 0: SlowCatalog, 1: FastCatalog
+const char*     OPTION_CATALOG_TYPE                            = "Catalog/type";
+const int       OPTION_CATALOG_TYPE_DEFAULT                    = 0;
+
+// Searches checking at least this many items are split across the thread pool,
+// 0 disables parallel searching
+const char*     OPTION_CATALOG_PARALLELTHRESHOLD               = "Catalog/parallelThreshold";
+const int       OPTION_CATALOG_PARALLELTHRESHOLD_DEFAULT       = 50000;
+
+// Typos a search tolerates, one per 4 query characters at most,
+// 0 only accepts exact subsequence matches
+const char*     OPTION_CATALOG_FUZZYEDITS                      = "Catalog/fuzzyEdits";
+const int       OPTION_CATALOG_FUZZYEDITS_DEFAULT              = 0;
+
+// Threads listing the catalog directories, 0 means one per core
+const char*     OPTION_CATALOG_INDEXTHREADS                    = "Catalog/indexThreads";
+const int       OPTION_CATALOG_INDEXTHREADS_DEFAULT            = 0;
+
+// Directories listed at the same time on one filesystem, keeps
+// slow network mounts from taking every indexing thread
+const char*     OPTION_CATALOG_INDEXTHREADSPERDEVICE           = "Catalog/indexThreadsPerDevice";
+const int       OPTION_CATALOG_INDEXTHREADSPERDEVICE_DEFAULT   = 2;
+
+// Watch the indexed directories and apply their changes to the catalog,
+// directories beyond the watch limit are rescanned every rebuild interval
+const char*     OPTION_CATALOG_WATCH                           = "Catalog/watch";
+const bool      OPTION_CATALOG_WATCH_DEFAULT                   = true;
+
+// Minutes between full rebuilds while watching, catching changes the
+// watcher missed, 0 disables them
+const char*     OPTION_CATALOG_SWEEPINTERVAL                   = "Catalog/sweepInterval";
+const int       OPTION_CATALOG_SWEEPINTERVAL_DEFAULT           = 24 * 60;
+
+// Search
+// Milliseconds each catalog search stage may take before it gives up
+// with what it has, plugins over it are only logged, 0 means unlimited
+const char*     OPTION_SEARCH_STAGEBUDGET                      = "Search/stageBudget";
+const int       OPTION_SEARCH_STAGEBUDGET_DEFAULT              = 100;
+
 }
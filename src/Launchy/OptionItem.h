@@ -132,4 +132,30 @@ extern const int        OPTION_LOGLEVEL_DEFAULT;
 
 extern const char*      OPTION_LANGUAGE;
 extern const char*      OPTION_LANGUAGE_DEFAULT;
+
+// catalog
+extern const char*      OPTION_CATALOG_TYPE;
+extern const int        OPTION_CATALOG_TYPE_DEFAULT;
+
+extern const char*      OPTION_CATALOG_PARALLELTHRESHOLD;
+extern const int        OPTION_CATALOG_PARALLELTHRESHOLD_DEFAULT;
+
+extern const char*      OPTION_CATALOG_FUZZYEDITS;
+extern const int        OPTION_CATALOG_FUZZYEDITS_DEFAULT;
+
+extern const char*      OPTION_CATALOG_INDEXTHREADS;
+extern const int        OPTION_CATALOG_INDEXTHREADS_DEFAULT;
+
+extern const char*      OPTION_CATALOG_INDEXTHREADSPERDEVICE;
+extern const int        OPTION_CATALOG_INDEXTHREADSPERDEVICE_DEFAULT;
+
+extern const char*      OPTION_CATALOG_WATCH;
+extern const bool       OPTION_CATALOG_WATCH_DEFAULT;
+
+extern const char*      OPTION_CATALOG_SWEEPINTERVAL;
+extern const int        OPTION_CATALOG_SWEEPINTERVAL_DEFAULT;
+
+// search
+extern const char*      OPTION_SEARCH_STAGEBUDGET;
+extern const int        OPTION_SEARCH_STAGEBUDGET_DEFAULT;
 }
@@ -64,12 +64,19 @@ void PluginHandler::getLabels(QList<InputData>* inputData) {
     }
 }
 
-void PluginHandler::getResults(QList<InputData>* inputData, QList<CatItem>* results) {
+void PluginHandler::getResults(QList<InputData>* inputData, QList<CatItem>* results, int budget) {
     if (!inputData->isEmpty()) {
+        QElapsedTimer timer;
+        timer.start();
+        // Every plugin runs, dropping some would depend on the hash order
         foreach(PluginInfo info, m_plugins) {
             if (info.loaded)
                 info.sendMsg(MSG_GET_RESULTS, (void*)inputData, (void*)results);
         }
+        if (budget > 0 && timer.elapsed() > budget) {
+            qWarning() << "PluginHandler::getResults, plugins took" << timer.elapsed()
+                << "ms, over the budget of" << budget << "ms";
+        }
     }
 }
 
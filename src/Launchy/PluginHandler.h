@@ -36,7 +36,8 @@ public:
     void showLaunchy();
     void hideLaunchy();
     void getLabels(QList<InputData>* inputData);
-    void getResults(QList<InputData>* inputData, QList<CatItem>* results);
+    // Plugins taking longer than the budget in milliseconds are logged, 0 means unlimited
+    void getResults(QList<InputData>* inputData, QList<CatItem>* results, int budget = 0);
     void getCatalogs(Catalog* catalog, INotifyProgressStep* progressStep);
     int launchItem(QList<InputData>* inputData, CatItem* item);
     QWidget* doDialog(QWidget* parent, uint pluginId);
@@ -0,0 +1,150 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RecentChoices.h"
+#include "CatalogItem.h"
+#include "GlobalVar.h"
+#include "OptionItem.h"
+#include <QSaveFile>
+
+namespace launchy {
+
+// Bumped whenever the layout of the choices file changes
+static const quint32 CHOICES_VERSION = 1;
+
+RecentChoices::RecentChoices() {
+
+}
+
+bool RecentChoices::load(const QString& filename) {
+    QFile inFile(filename);
+    if (!inFile.open(QIODevice::ReadOnly)) {
+        qInfo() << "RecentChoices::load, fail to open choices file:" << filename;
+        if (inFile.exists()) {
+            QMutexLocker locker(&m_mutex);
+            m_unreadable = filename;
+        }
+        return false;
+    }
+
+    QDataStream in(&inFile);
+    in.setVersion(QDataStream::Qt_5_0);
+
+    quint32 version = 0;
+    in >> version;
+    if (version != CHOICES_VERSION) {
+        qWarning() << "RecentChoices::load, unknown choices file version:" << version;
+        QMutexLocker locker(&m_mutex);
+        m_unreadable = filename;
+        return false;
+    }
+
+    QHash<QString, Choice> choices;
+    while (!in.atEnd()) {
+        QString text;
+        Choice choice;
+        in >> text >> choice.shortName >> choice.fullPath;
+        if (in.status() != QDataStream::Ok) {
+            qWarning() << "RecentChoices::load, choices file is truncated:" << filename;
+            break;
+        }
+        choices.insert(text, choice);
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_choices.swap(choices);
+    m_unreadable.clear();
+    return true;
+}
+
+bool RecentChoices::save(const QString& filename) const {
+    QByteArray ba;
+    QDataStream out(&ba, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << CHOICES_VERSION;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (filename == m_unreadable) {
+            qWarning() << "RecentChoices::save, keeping the choices file it could not read:"
+                << filename;
+            return false;
+        }
+        for (auto it = m_choices.constBegin(); it != m_choices.constEnd(); ++it) {
+            out << it.key() << it->shortName << it->fullPath;
+        }
+    }
+
+    // A crash while writing leaves the previous file in place
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(ba) < 0
+        || !file.commit()) {
+        qWarning("RecentChoices::save, Could not write choices file");
+        return false;
+    }
+    return true;
+}
+
+void RecentChoices::importSettings(const QString& filename) {
+    g_settings->beginGroup("History");
+    QStringList keys = g_settings->childKeys();
+    int imported = 0;
+    foreach(const QString& key, keys) {
+        QStringList hist = g_settings->value(key).toStringList();
+        if (hist.count() == 2) {
+            Choice choice = { hist[0], hist[1] };
+            QMutexLocker locker(&m_mutex);
+            m_choices.insert(key.toLower(), choice);
+            ++imported;
+        }
+    }
+    g_settings->endGroup();
+
+    // The choices are kept in their own file from now on,
+    // the settings keep them until the file is written
+    if (!keys.isEmpty() && save(filename)) {
+        g_settings->remove("History");
+        qInfo() << "RecentChoices::importSettings, imported" << imported << "choices";
+    }
+}
+
+bool RecentChoices::setChoice(const QString& text, const CatItem& item) {
+    QString key = text.toLower();
+    QMutexLocker locker(&m_mutex);
+    auto it = m_choices.find(key);
+    if (it != m_choices.end()
+        && it->shortName == item.shortName && it->fullPath == item.fullPath) {
+        return false;
+    }
+    Choice choice = { item.shortName, item.fullPath };
+    m_choices.insert(key, choice);
+    return true;
+}
+
+bool RecentChoices::choice(const QString& text, QString& shortName, QString& fullPath) const {
+    QMutexLocker locker(&m_mutex);
+    auto it = m_choices.constFind(text);
+    if (it == m_choices.constEnd()) {
+        return false;
+    }
+    shortName = it->shortName;
+    fullPath = it->fullPath;
+    return true;
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QString>
+#include <QHash>
+#include <QMutex>
+
+namespace launchy {
+
+class CatItem;
+
+// RecentChoices remembers which item was chosen from the alternatives list
+// for a query, so the same query shows that item first next time.
+// Lookups are a single hash probe, they may come from any thread.
+class RecentChoices {
+public:
+    RecentChoices();
+
+    // Return false if there is no choices file to load, or it cannot be
+    // read, a file which exists but cannot be read is never overwritten
+    bool load(const QString& filename);
+    bool save(const QString& filename) const;
+    // Take over the choices still kept in the settings by older versions,
+    // the settings drop them once they are saved to filename
+    void importSettings(const QString& filename);
+
+    // Return false if the item already was the choice for the text
+    bool setChoice(const QString& text, const CatItem& item);
+    bool choice(const QString& text, QString& shortName, QString& fullPath) const;
+
+private:
+    struct Choice {
+        QString shortName;
+        QString fullPath;
+    };
+
+private:
+    // Keys are lower case queries
+    QHash<QString, Choice> m_choices;
+    // A choices file load() found but could not read, such as one of a newer version
+    QString m_unreadable;
+    mutable QMutex m_mutex;
+};
+
+}
@@ -0,0 +1,69 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QAtomicInt>
+#include <QElapsedTimer>
+
+namespace launchy {
+
+// SearchControl lets a running catalog search stop early, either because
+// a newer search has replaced it or because its time budget is used up.
+// It is polled from the search threads, so it only reads shared state.
+class SearchControl {
+public:
+    // budget is in milliseconds, 0 means unlimited
+    SearchControl(const QAtomicInt* generation, int expected, int budget);
+
+    bool isCancelled() const;
+    bool isExpired() const;
+    bool shouldStop() const;
+    qint64 elapsed() const;
+
+private:
+    const QAtomicInt* m_generation;
+    int m_expected;
+    int m_budget;
+    QElapsedTimer m_timer;
+};
+
+inline SearchControl::SearchControl(const QAtomicInt* generation, int expected, int budget)
+    : m_generation(generation),
+      m_expected(expected),
+      m_budget(budget) {
+    m_timer.start();
+}
+
+inline bool SearchControl::isCancelled() const {
+    return m_generation && m_generation->load() != m_expected;
+}
+
+inline bool SearchControl::isExpired() const {
+    return m_budget > 0 && m_timer.elapsed() > m_budget;
+}
+
+inline bool SearchControl::shouldStop() const {
+    return isCancelled() || isExpired();
+}
+
+inline qint64 SearchControl::elapsed() const {
+    return m_timer.elapsed();
+}
+
+}
@@ -0,0 +1,69 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SearchSession.h"
+
+namespace launchy {
+
+// Longest query chain kept, deeper entries are usually tiny anyway
+static const int MAX_SESSION_DEPTH = 32;
+
+SearchSession::SearchSession() {
+
+}
+
+void SearchSession::clear() {
+    m_entries.clear();
+}
+
+const QVector<int>* SearchSession::candidates(const QString& text, int edits) const {
+    for (int i = m_entries.size() - 1; i >= 0; --i) {
+        if (text.startsWith(m_entries[i].text) && m_entries[i].edits >= edits) {
+            return &m_entries[i].matches;
+        }
+    }
+    return nullptr;
+}
+
+void SearchSession::store(const QString& text, const QVector<int>& matches, int edits) {
+    if (text.isEmpty()) {
+        return;
+    }
+
+    while (!m_entries.isEmpty() && !text.startsWith(m_entries.last().text)) {
+        m_entries.pop_back();
+    }
+
+    if (!m_entries.isEmpty() && m_entries.last().text == text) {
+        m_entries.last().matches = matches;
+        m_entries.last().edits = edits;
+        return;
+    }
+
+    if (m_entries.size() >= MAX_SESSION_DEPTH) {
+        m_entries.pop_back();
+    }
+
+    Entry entry;
+    entry.text = text;
+    entry.matches = matches;
+    entry.edits = edits;
+    m_entries.push_back(entry);
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+
+namespace launchy {
+
+// SearchSession remembers the catalog items matched by the previous queries.
+// Every item matching a query also matches all of its prefixes, so a query
+// which extends a cached one only has to check the cached matches instead
+// of the whole catalog. The cached queries form a chain where each one is
+// a prefix of the next, which keeps the ancestors around for backspace.
+// Fuzzy searches only narrow results cached with at least as many tolerated
+// typos, a match with more typos than the cached query allowed could have
+// been filtered out.
+class SearchSession {
+public:
+    SearchSession();
+
+    // Forget all cached results, must be called whenever catalog items
+    // are added, removed or renamed
+    void clear();
+
+    // Return the matches of the longest cached query which text starts with,
+    // or nullptr if the whole catalog has to be searched
+    const QVector<int>* candidates(const QString& text, int edits = 0) const;
+
+    // Remember the matches of text, dropping cached queries
+    // which are not a prefix of it
+    void store(const QString& text, const QVector<int>& matches, int edits = 0);
+
+private:
+    struct Entry {
+        QString text;
+        QVector<int> matches;
+        int edits;
+    };
+
+    QVector<Entry> m_entries;
+};
+
+}
@@ -0,0 +1,148 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SearchWorker.h"
+#include <QtConcurrent>
+#include "Catalog.h"
+#include "CatalogBuilder.h"
+#include "GlobalVar.h"
+#include "SearchControl.h"
+#include "SettingsSnapshot.h"
+
+namespace launchy {
+
+SearchWorker::SearchWorker(QObject* parent)
+    : QObject(parent),
+      m_generation(0),
+      m_pending(false),
+      m_delivered(0) {
+    m_pool.setMaxThreadCount(1);
+    connect(&m_watcher, SIGNAL(resultsReadyAt(int, int)), this, SLOT(onResultsReady(int, int)));
+}
+
+SearchWorker::~SearchWorker() {
+    cancel();
+    m_pool.waitForDone();
+}
+
+void SearchWorker::search(const QString& text) {
+    int generation = m_generation.fetchAndAddOrdered(1) + 1;
+    int budget = SettingsSnapshot::current()->searchStageBudget;
+    Catalog* catalog = g_catalog;
+
+    // Every stage reports one result to the future
+    QFutureInterface<Result> stages;
+    stages.reportStarted();
+    m_pending = true;
+    m_delivered = 0;
+    m_watcher.setFuture(stages.future());
+    QtConcurrent::run(&m_pool, [=]() mutable {
+        run(stages, catalog, &m_generation, generation, text, budget);
+        stages.reportFinished();
+    });
+}
+
+void SearchWorker::cancel() {
+    m_generation.ref();
+    m_pending = false;
+}
+
+bool SearchWorker::isPending() const {
+    return m_pending;
+}
+
+void SearchWorker::flush() {
+    if (!m_pending) {
+        return;
+    }
+    m_watcher.waitForFinished();
+
+    // Only the last stage matters now, skip the earlier ones
+    int count = m_watcher.future().resultCount();
+    if (count > 0) {
+        m_delivered = count - 1;
+        deliver(count - 1);
+    }
+    m_pending = false;
+}
+
+void SearchWorker::onResultsReady(int begin, int end) {
+    Q_UNUSED(begin);
+    // Stages ready together are only shown once, with the last one
+    if (end > m_delivered) {
+        deliver(end - 1);
+    }
+}
+
+void SearchWorker::deliver(int index) {
+    if (!m_pending || index < m_delivered) {
+        return;
+    }
+
+    Result result = m_watcher.resultAt(index);
+    if (result.generation != m_generation.load()) {
+        return;
+    }
+
+    m_delivered = index + 1;
+    if (result.stage == CatalogStage) {
+        m_pending = false;
+        emit searched(result.text, result.items);
+    }
+    else {
+        emit prefixSearched(result.text, result.items);
+    }
+}
+
+void SearchWorker::run(QFutureInterface<Result>& stages, Catalog* catalog,
+                       const QAtomicInt* generation, int expected,
+                       const QString& text, int budget) {
+    SearchControl control(generation, expected, budget);
+    if (control.isCancelled()) {
+        return;
+    }
+
+    Result result;
+    result.generation = expected;
+    result.stage = PrefixStage;
+    result.text = text;
+
+    // The items starting with the text are found quickly,
+    // they are shown while the full search runs
+    catalog->searchPrefix(text, result.items, &control);
+    if (control.isCancelled()) {
+        return;
+    }
+    stages.reportResult(result, PrefixStage);
+    qDebug() << "SearchWorker::run, prefix stage for" << text
+        << "done after" << control.elapsed() << "ms";
+
+    // Every stage has a budget of its own
+    SearchControl catalogControl(generation, expected, budget);
+    result.stage = CatalogStage;
+    result.items.clear();
+    catalog->searchCatalogs(text, result.items, &catalogControl);
+    if (catalogControl.isCancelled()) {
+        qDebug() << "SearchWorker::run, cancelled search for" << text
+            << "after" << catalogControl.elapsed() << "ms";
+        return;
+    }
+    stages.reportResult(result, CatalogStage);
+}
+
+}
@@ -0,0 +1,87 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QObject>
+#include <QList>
+#include <QAtomicInt>
+#include <QThreadPool>
+#include <QFutureWatcher>
+#include <QFutureInterface>
+#include "CatalogItem.h"
+
+namespace launchy {
+
+class Catalog;
+
+// SearchWorker runs catalog searches off the GUI thread. Every search gets
+// a new generation, starting a search cancels the one in flight, and only
+// the results of the newest generation are delivered.
+// Results arrive in stages, the items starting with the text through
+// prefixSearched() first, then every match through searched().
+class SearchWorker : public QObject {
+    Q_OBJECT
+public:
+    explicit SearchWorker(QObject* parent = nullptr);
+    virtual ~SearchWorker();
+
+    // Search the catalog for the lower case text in the background
+    void search(const QString& text);
+    // Drop the search in flight, its results are never delivered
+    void cancel();
+    bool isPending() const;
+    // Wait for the search in flight and deliver its results right away
+    void flush();
+
+signals:
+    void prefixSearched(const QString& text, const QList<CatItem>& result);
+    void searched(const QString& text, const QList<CatItem>& result);
+
+private slots:
+    void onResultsReady(int begin, int end);
+
+private:
+    enum Stage {
+        PrefixStage,
+        CatalogStage
+    };
+
+    struct Result {
+        int generation;
+        Stage stage;
+        QString text;
+        QList<CatItem> items;
+    };
+
+    void deliver(int index);
+    static void run(QFutureInterface<Result>& stages, Catalog* catalog,
+                    const QAtomicInt* generation, int expected,
+                    const QString& text, int budget);
+
+private:
+    // A single thread, searches queued behind a newer one are skipped
+    QThreadPool m_pool;
+    QAtomicInt m_generation;
+    QFutureWatcher<Result> m_watcher;
+    bool m_pending;
+    // Results of the current future delivered so far
+    int m_delivered;
+};
+
+}
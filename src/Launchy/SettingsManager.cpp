@@ -22,13 +22,21 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "LaunchyWidget.h"
 #include "GlobalVar.h"
 #include "AppBase.h"
+#include "Catalog.h"
+#include "CatalogBuilder.h"
 #include "Logger.h"
 #include "OptionItem.h"
+#include "SettingsSnapshot.h"
 #include "TranslationManager.h"
 
 static const char* iniName = "/launchy.ini";
 static const char* dbName = "/launchy.db";
+// Written next to the catalog by CatalogJournal and DirectoryIndexer
+static const char* catalogSideFiles[] = { "/launchy.db.journal", "/launchy.db.journal.old",
+                                          "/launchy.db.dirs" };
+static const char* fingerprintsName = "/launchy.db.dirs";
 static const char* historyName = "/history.db";
+static const char* choicesName = "/choices.db";
 static const char* installedName = "/.installed";
 
 // for QNetworkProxy::ProxyType in QVariant
@@ -118,6 +126,8 @@ void SettingsManager::load() {
 
     QNetworkProxy::setApplicationProxy(proxy);
 
+    SettingsSnapshot::refresh();
+
     // load language translation
     QString lang = g_settings->value(OPTION_LANGUAGE, OPTION_LANGUAGE_DEFAULT).toString();
     if (lang.isEmpty()) {
@@ -144,6 +154,10 @@ QString SettingsManager::historyFilename() const {
     return configDirectory(m_portable) + historyName;
 }
 
+QString SettingsManager::choicesFilename() const {
+    return configDirectory(m_portable) + choicesName;
+}
+
 // Find the skin with the specified name ensuring that it contains at least a stylesheet
 QString SettingsManager::skinPath(const QString& skinName) const {
     QString directory;
@@ -175,6 +189,7 @@ void SettingsManager::setPortable(bool makePortable) {
     QString oldIniName = oldDir + iniName;
     QString oldDbName = oldDir + dbName;
     QString oldHistoryName = oldDir + historyName;
+    QString oldChoicesName = oldDir + choicesName;
 
     // Copy the settings to the new location
     // and delete the original settings if they are copied successfully
@@ -188,6 +203,31 @@ void SettingsManager::setPortable(bool makePortable) {
         QFile::remove(oldHistoryName);
         QFile::remove(newDir + installedName);
 
+        // The choices file is only written once something was chosen
+        if (QFile::exists(oldChoicesName)
+            && QFile::copy(oldChoicesName, newDir + choicesName)) {
+            QFile::remove(oldChoicesName);
+        }
+        // Spares listing the unchanged directories again, written by the first build
+        if (QFile::exists(oldDir + fingerprintsName)
+            && QFile::copy(oldDir + fingerprintsName, newDir + fingerprintsName)) {
+            QFile::remove(oldDir + fingerprintsName);
+        }
+
+        // Saving the catalog at the new place folds its journal into the image
+        // there and starts the journal over beside it, the journals left beside
+        // the old image would be replayed over a newer one after converting back.
+        // A catalog still loading is saved once it is loaded, changes a running
+        // build makes meanwhile go to the journal at the new place
+        if (g_catalog->save(newDir + dbName)) {
+            for (const char* sideFile : catalogSideFiles) {
+                QFile::remove(oldDir + sideFile);
+            }
+        }
+        else {
+            qWarning() << "SettingsManager::setPortable, fail to save catalog to" << newDir;
+        }
+
         if (!makePortable && !QDir(oldDir).rmdir(".")) {
             // if converting to installed mode,
             // try to remove portable mode config directory if it is empty.
@@ -221,10 +261,18 @@ void SettingsManager::removeAll() {
     QFile::remove(configDirectory(false) + iniName);
     QFile::remove(configDirectory(false) + dbName);
     QFile::remove(configDirectory(false) + historyName);
+    QFile::remove(configDirectory(false) + choicesName);
+    for (const char* sideFile : catalogSideFiles) {
+        QFile::remove(configDirectory(false) + sideFile);
+    }
 
     QFile::remove(configDirectory(true) + iniName);
     QFile::remove(configDirectory(true) + dbName);
     QFile::remove(configDirectory(true) + historyName);
+    QFile::remove(configDirectory(true) + choicesName);
+    for (const char* sideFile : catalogSideFiles) {
+        QFile::remove(configDirectory(true) + sideFile);
+    }
 }
 
 // Get the configuration directory
@@ -36,6 +36,7 @@ public:
     QList<QString> directory(QString name) const;
     QString catalogFilename() const;
     QString historyFilename() const;
+    QString choicesFilename() const;
     QString skinPath(const QString& skinName) const;
     void setPortable(bool makePortable);
     void removeAll();
@@ -0,0 +1,113 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SettingsSnapshot.h"
+#include <QMutex>
+#include "GlobalVar.h"
+#include "OptionItem.h"
+
+namespace launchy {
+
+static SettingsSnapshotPtr s_current;
+// Serializes refreshes, readers only load s_current atomically
+static QMutex s_refreshMutex;
+
+SettingsSnapshot::SettingsSnapshot()
+    : generation(0),
+      decorateText(OPSTION_DECORATETEXT_DEFAULT),
+      autoSuggestDelay(OPSTION_AUTOSUGGESTDELAY_DEFAULT),
+      numViewable(OPSTION_NUMVIEWABLE_DEFAULT),
+      numResult(OPSTION_NUMRESULT_DEFAULT),
+      maxItemsInHistory(OPSTION_MAXITEMSINHISTORY_DEFAULT),
+      opaqueness(OPSTION_OPAQUENESS_DEFAULT),
+      fadeIn(OPSTION_FADEIN_DEFAULT),
+      fadeOut(OPSTION_FADEOUT_DEFAULT),
+      condensedView(OPSTION_CONDENSEDVIEW_DEFAULT),
+      catalogParallelThreshold(OPTION_CATALOG_PARALLELTHRESHOLD_DEFAULT),
+      catalogFuzzyEdits(OPTION_CATALOG_FUZZYEDITS_DEFAULT),
+      searchStageBudget(OPTION_SEARCH_STAGEBUDGET_DEFAULT) {
+
+}
+
+SettingsSnapshotPtr SettingsSnapshot::current() {
+    SettingsSnapshotPtr snapshot = std::atomic_load(&s_current);
+    if (!snapshot) {
+        // First use, before the settings were loaded the defaults apply
+        refresh();
+        snapshot = std::atomic_load(&s_current);
+    }
+    return snapshot;
+}
+
+bool SettingsSnapshot::refresh() {
+    QMutexLocker locker(&s_refreshMutex);
+
+    SettingsSnapshotPtr previous = std::atomic_load(&s_current);
+    std::shared_ptr<SettingsSnapshot> next(new SettingsSnapshot());
+    if (!g_settings.isNull()) {
+        next->read();
+    }
+
+    if (previous && previous->sameValues(*next)) {
+        return false;
+    }
+
+    next->generation = previous ? previous->generation + 1 : 0;
+    std::atomic_store(&s_current, SettingsSnapshotPtr(next));
+    qDebug() << "SettingsSnapshot::refresh, generation:" << next->generation;
+    return true;
+}
+
+void SettingsSnapshot::read() {
+    decorateText = g_settings->value(OPSTION_DECORATETEXT, OPSTION_DECORATETEXT_DEFAULT).toBool();
+    autoSuggestDelay = g_settings->value(OPSTION_AUTOSUGGESTDELAY,
+                                         OPSTION_AUTOSUGGESTDELAY_DEFAULT).toInt();
+    numViewable = g_settings->value(OPSTION_NUMVIEWABLE, OPSTION_NUMVIEWABLE_DEFAULT).toInt();
+    numResult = g_settings->value(OPSTION_NUMRESULT, OPSTION_NUMRESULT_DEFAULT).toInt();
+    maxItemsInHistory = g_settings->value(OPSTION_MAXITEMSINHISTORY,
+                                          OPSTION_MAXITEMSINHISTORY_DEFAULT).toInt();
+    opaqueness = g_settings->value(OPSTION_OPAQUENESS, OPSTION_OPAQUENESS_DEFAULT).toInt();
+    fadeIn = g_settings->value(OPSTION_FADEIN, OPSTION_FADEIN_DEFAULT).toInt();
+    fadeOut = g_settings->value(OPSTION_FADEOUT, OPSTION_FADEOUT_DEFAULT).toInt();
+    condensedView = g_settings->value(OPSTION_CONDENSEDVIEW, OPSTION_CONDENSEDVIEW_DEFAULT).toInt();
+
+    catalogParallelThreshold = g_settings->value(OPTION_CATALOG_PARALLELTHRESHOLD,
+                                                 OPTION_CATALOG_PARALLELTHRESHOLD_DEFAULT).toInt();
+    catalogFuzzyEdits = g_settings->value(OPTION_CATALOG_FUZZYEDITS,
+                                          OPTION_CATALOG_FUZZYEDITS_DEFAULT).toInt();
+
+    searchStageBudget = g_settings->value(OPTION_SEARCH_STAGEBUDGET,
+                                          OPTION_SEARCH_STAGEBUDGET_DEFAULT).toInt();
+}
+
+bool SettingsSnapshot::sameValues(const SettingsSnapshot& other) const {
+    return decorateText == other.decorateText
+        && autoSuggestDelay == other.autoSuggestDelay
+        && numViewable == other.numViewable
+        && numResult == other.numResult
+        && maxItemsInHistory == other.maxItemsInHistory
+        && opaqueness == other.opaqueness
+        && fadeIn == other.fadeIn
+        && fadeOut == other.fadeOut
+        && condensedView == other.condensedView
+        && catalogParallelThreshold == other.catalogParallelThreshold
+        && catalogFuzzyEdits == other.catalogFuzzyEdits
+        && searchStageBudget == other.searchStageBudget;
+}
+
+}
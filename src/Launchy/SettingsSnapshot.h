@@ -0,0 +1,67 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+
+namespace launchy {
+
+class SettingsSnapshot;
+typedef std::shared_ptr<const SettingsSnapshot> SettingsSnapshotPtr;
+
+// SettingsSnapshot holds typed copies of the settings read on hot paths,
+// such as every search, list repaint or fade, so those paths do not look
+// up string keys in QSettings and convert QVariants each time.
+// A snapshot never changes, refresh() publishes a new one after the
+// settings are changed, and current() may be called from any thread.
+class SettingsSnapshot {
+public:
+    static SettingsSnapshotPtr current();
+    // Read the settings again, return true if any of the values changed
+    static bool refresh();
+
+public:
+    // Incremented by every refresh with changed values
+    int generation;
+
+    // general
+    bool decorateText;
+    int autoSuggestDelay;
+    int numViewable;
+    int numResult;
+    int maxItemsInHistory;
+    int opaqueness;
+    int fadeIn;
+    int fadeOut;
+    int condensedView;
+
+    // catalog
+    int catalogParallelThreshold;
+    int catalogFuzzyEdits;
+
+    // search
+    int searchStageBudget;
+
+private:
+    SettingsSnapshot();
+    void read();
+    bool sameValues(const SettingsSnapshot& other) const;
+};
+
+}
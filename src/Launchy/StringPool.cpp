@@ -0,0 +1,70 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StringPool.h"
+
+namespace launchy {
+
+StringPool::StringPool() {
+    clear();
+}
+
+void StringPool::clear() {
+    m_strings.clear();
+    m_handles.clear();
+    m_strings.push_back(QString());
+    m_handles.insert(QString(), 0);
+}
+
+int StringPool::intern(const QString& str) {
+    auto it = m_handles.constFind(str);
+    if (it != m_handles.constEnd()) {
+        return it.value();
+    }
+    int handle = m_strings.size();
+    m_strings.push_back(str);
+    m_handles.insert(str, handle);
+    return handle;
+}
+
+void StringPool::assign(const QVector<QString>& strings) {
+    m_strings = strings;
+    m_handles.clear();
+    m_handles.reserve(m_strings.size());
+    for (int i = 0; i < m_strings.size(); ++i) {
+        m_handles.insert(m_strings[i], i);
+    }
+}
+
+int StringPool::find(const QString& str) const {
+    return m_handles.value(str, -1);
+}
+
+qint64 StringPool::memoryUsage() const {
+    // The hash keys share their data with the vector
+    qint64 bytes = m_strings.capacity() * sizeof(QString);
+    foreach(const QString& str, m_strings) {
+        bytes += stringMemoryUsage(str);
+    }
+    // A hash node holds the next pointer, the hash, the key and the value
+    bytes += m_handles.capacity() * sizeof(void*)
+        + m_handles.size() * (sizeof(void*) + sizeof(uint) + sizeof(QString) + sizeof(int));
+    return bytes;
+}
+
+}
@@ -0,0 +1,70 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <QHash>
+
+namespace launchy {
+
+// StringPool interns strings repeated by many catalog items, such as
+// directories and icon paths, and hands out an index for each of them.
+// Handle 0 is always the empty string. The strings are kept in a vector
+// which snapshots share implicitly, the lookup hash stays with the writer.
+class StringPool {
+public:
+    StringPool();
+
+    void clear();
+    int count() const;
+    int intern(const QString& str);
+    // Replace the pool by strings, which hold the empty string at
+    // handle 0 followed by distinct strings, as written by strings()
+    void assign(const QVector<QString>& strings);
+    // Return the handle of str, or -1 if it has not been interned
+    int find(const QString& str) const;
+    const QVector<QString>& strings() const;
+
+    // Approximate heap bytes held by the strings and the lookup hash
+    qint64 memoryUsage() const;
+
+private:
+    QVector<QString> m_strings;
+    QHash<QString, int> m_handles;
+};
+
+inline int StringPool::count() const {
+    return m_strings.size();
+}
+
+inline const QVector<QString>& StringPool::strings() const {
+    return m_strings;
+}
+
+// Approximate heap bytes of the character data of a string
+inline qint64 stringMemoryUsage(int length) {
+    return sizeof(QArrayData) + (length + 1) * sizeof(QChar);
+}
+
+inline qint64 stringMemoryUsage(const QString& str) {
+    return str.isNull() ? 0 : stringMemoryUsage(str.capacity());
+}
+
+}
@@ -0,0 +1,183 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SubsequenceMatcher.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LAUNCHY_MATCHER_X86
+#endif
+#endif
+
+#ifdef LAUNCHY_MATCHER_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define LAUNCHY_TARGET_AVX2
+#else
+#define LAUNCHY_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace launchy {
+
+typedef bool (*MatchFunc)(const ushort*, int, const ushort*, int);
+
+// Find c in name[pos, length), return the index after it or -1
+static inline int findScalar(const ushort* name, int pos, int length, ushort c) {
+    for (; pos < length; ++pos) {
+        if (name[pos] == c) {
+            return pos + 1;
+        }
+    }
+    return -1;
+}
+
+static bool matchScalar(const ushort* name, int length,
+                        const ushort* query, int queryLength) {
+    int pos = 0;
+    for (int i = 0; i < queryLength; ++i) {
+        pos = findScalar(name, pos, length, query[i]);
+        if (pos < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef LAUNCHY_MATCHER_X86
+
+static inline int lowestBit(unsigned mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+static inline int findSse2(const ushort* name, int pos, int length, ushort c) {
+    const __m128i needle = _mm_set1_epi16((short)c);
+    for (; length - pos >= 8; pos += 8) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(name + pos));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(block, needle));
+        if (mask) {
+            return pos + lowestBit(mask) / 2 + 1;
+        }
+    }
+    return findScalar(name, pos, length, c);
+}
+
+static bool matchSse2(const ushort* name, int length,
+                      const ushort* query, int queryLength) {
+    int pos = 0;
+    for (int i = 0; i < queryLength; ++i) {
+        pos = findSse2(name, pos, length, query[i]);
+        if (pos < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+LAUNCHY_TARGET_AVX2
+static inline int findAvx2(const ushort* name, int pos, int length, ushort c) {
+    const __m256i needle = _mm256_set1_epi16((short)c);
+    for (; length - pos >= 16; pos += 16) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(name + pos));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi16(block, needle));
+        if (mask) {
+            return pos + lowestBit(mask) / 2 + 1;
+        }
+    }
+    return findSse2(name, pos, length, c);
+}
+
+LAUNCHY_TARGET_AVX2
+static bool matchAvx2(const ushort* name, int length,
+                      const ushort* query, int queryLength) {
+    int pos = 0;
+    for (int i = 0; i < queryLength; ++i) {
+        pos = findAvx2(name, pos, length, query[i]);
+        if (pos < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool cpuSupportsAvx2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    // The OS has to save the ymm registers too
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif // LAUNCHY_MATCHER_X86
+
+struct MatcherDispatch {
+    MatchFunc func;
+    const char* name;
+
+    MatcherDispatch()
+        : func(matchScalar),
+          name("scalar") {
+#ifdef LAUNCHY_MATCHER_X86
+        if (cpuSupportsAvx2()) {
+            func = matchAvx2;
+            name = "avx2";
+        }
+        else {
+            func = matchSse2;
+            name = "sse2";
+        }
+#endif
+    }
+};
+
+static const MatcherDispatch s_dispatch;
+
+bool SubsequenceMatcher::matches(const ushort* name, int length,
+                                 const ushort* query, int queryLength) {
+    if (queryLength > length) {
+        return false;
+    }
+    return s_dispatch.func(name, length, query, queryLength);
+}
+
+const char* SubsequenceMatcher::implementation() {
+    return s_dispatch.name;
+}
+
+}
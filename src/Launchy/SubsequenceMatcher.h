@@ -0,0 +1,38 @@
+/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QtGlobal>
+
+namespace launchy {
+
+// SubsequenceMatcher checks whether a query is an in-order subsequence of a
+// packed UTF-16 name, with the same greedy semantics as Catalog::matches.
+// Every query character is located with vector compares (AVX2 or SSE2,
+// selected at runtime) and a scalar loop handles the tail of the name.
+class SubsequenceMatcher {
+public:
+    static bool matches(const ushort* name, int length,
+                        const ushort* query, int queryLength);
+
+    // Name of the implementation picked for this cpu
+    static const char* implementation();
+};
+
+}
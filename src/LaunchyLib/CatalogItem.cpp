@@ -19,7 +19,6 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include "CatalogItem.h"
 #include <QDataStream>
-#include <QDebug>
 #include "UnicodeTable.h"
 
 namespace launchy {
@@ -115,19 +114,39 @@ QDataStream& operator>>(QDataStream& in, CatItem &item) {
 }
 
 QString CatItem::convertSearchName(const QString& shortName) {
-    QString result = shortName.toLower();
+    QString lower = shortName.toLower();
+
+    // Most names are plain ASCII, they are searched by their lower form
+    const ushort* begin = lower.utf16();
+    const ushort* end = begin + lower.size();
+    const ushort* ascii = begin;
+    while (ascii != end && *ascii < 0x80) {
+        ++ascii;
+    }
+    if (ascii == end) {
+        return lower;
+    }
 
-    for (int i = 0; i<result.size(); ++i) {
-        ushort code = result[i].unicode();
+    QString result(lower.size() * TRANSLITERATION_MAX_LENGTH, Qt::Uninitialized);
+    ushort* out = reinterpret_cast<ushort*>(result.data());
+    for (const ushort* in = begin; in != ascii; ++in) {
+        *out++ = *in;
+    }
 
-        // zhCN simplified Chinese (pin yin)
-        if (code >= zhCN_min && code <= zhCN_max) {
-            result[i] = zhCN_table[code - zhCN_min];
+    for (const ushort* in = ascii; in != end; ++in) {
+        ushort code = *in;
+        const char* text;
+        int length;
+        if (code < 0x80 || (length = transliterate(code, &text)) < 0) {
+            *out++ = code;
+            continue;
+        }
+        for (int i = 0; i < length; ++i) {
+            *out++ = static_cast<uchar>(text[i]);
         }
-
     }
-    qDebug() << "CatItem::convertSearchName, shortName:" << shortName
-        << ", result:" << result;
+
+    result.truncate(static_cast<int>(out - reinterpret_cast<ushort*>(result.data())));
     return result;
 }
 
@@ -23,6 +23,18 @@ HEADERS += CatalogItem.h \
 
 DEFINES += LAUNCHY_LIB
 
+# UnicodeTable.cpp is generated from the tables directory,
+# run "make unicode_table" after changing them
+unicode_table.commands = python3 $$PWD/tables/gen_unicode_table.py $$PWD/UnicodeTable.cpp
+unicode_table.depends = $$PWD/tables/gen_unicode_table.py \
+                        $$PWD/tables/zhCN_initials.txt \
+                        $$PWD/tables/zhCN_polyphones.txt
+QMAKE_EXTRA_TARGETS += unicode_table
+
+OTHER_FILES += tables/gen_unicode_table.py \
+               tables/zhCN_initials.txt \
+               tables/zhCN_polyphones.txt
+
 if(!debug_and_release|build_pass) {
     CONFIG(debug, debug|release):DESTDIR = ../debug/
     CONFIG(release, debug|release):DESTDIR = ../release/
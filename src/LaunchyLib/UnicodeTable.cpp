@@ -16,219 +16,1695 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+// Generated by tables/gen_unicode_table.py, do not edit
+
 #include "UnicodeTable.h"
-#include <cstring>
 
-const ushort zhCN_min = 19968;
-const ushort zhCN_max = static_cast<ushort>(zhCN_min + std::strlen(zhCN_table));
-const char*  zhCN_table =
-"ydyqsxmwzssxjbymgcczqpssqbycdscdqldylybssjgyzzjjfkcclzdhwdwzjljpfyynwjjtmyhzwzhflzppqhgscyyynjqyxxgj"
-"hhsdsjnkktmomlcrxypsnqseccqzggllyjlmyzzsecykyyhqwjssggyxyzyjwwkdjhychmyxjtlxjyqbyxzldwrdjrwysrldzjpc"
-"bzjjbrcftleczstzfxxzhtrqhybdlyczssymmrfmyqzpwwjjyfcrwfdfzqpyddwyxkyjawjffxypsftzyhhyzyswcjyxsclcxxwz"
-"zxnbgnnxbxlzszsbsgpysyzdhmdzbqbzcwdzzyytzhbtsyybzgntnxqywqskbphhlxgybfmjebjhhgqtjcysxstkzhlyckglysmz"
-"xyalmeldccxgzyrjxsdltyzcqkcnnjwhjtzzcqljststbnxbtyxceqxgkwjyflzqlyhyxspsfxlmpbysxxxydjczylllsjxfhjxp"
-"jbtffyabyxbhzzbjyzlwlczggbtssmdtjzxpthyqtgljscqfzkjzjqnlzwlslhdzbwjncjzyzsqqycqyrzcjjwybrtwpyftwexcs"
-"kdzctbzhyzzyyjxzcffzzmjyxxsdzzottbzlqwfckszsxfyrlnyjmbdthjxsqqccsbxyytsyfbxdztgbcnslcyzzpsazyzzscjcs"
-"hzqydxlbpjllmqxtydzxsqjtzpxlcglqtzwjbhctsyjsfxyejjtlbgxsxjmyjqqpfzasyjntydjxkjcdjszcbartdclyjqmwnqnc"
-"lllkbybzzsyhqqltwlccxtxllzntylnewyzyxczxxgrkrmtcndnjtsyyssdqdghsdbjghrwrqlybglxhlgtgxbqjdzpyjsjyjctm"
-"rnymgrzjczgjmzmgxmpryxkjnymsgmzjymkmfxmldtgfbhcjhkylpfmdxlqjjsmtqgzsjlqdldgjycalcmzcsdjllnxdjffffjcz"
-"fmzffpfkhkgdpsxktacjdhhzddcrrcfqyjkqccwjdxhwjlyllzgcfcqdsmlzpbjjplsbcjggdckkdezsqcckjgcgkdjtjdlzycxk"
-"lqscgjcltfpcqczgwpjdqyzjjbyjhsjdzwgfsjgzkqcczllpspkjgqjhzzljplgjgjjthjjyjzczmlzlyqbgjwmljkxzdznjqsyz"
-"mljlljkywxmkjlhskjgbmclyymkxjqlbmllkmdxxkwyxyslmlpsjqqjqxyxfjtjdxmxxllcxqbsyjbgwymbggbcyxpjygpepfgdj"
-"gbhbnsqjyzjkjkhxqfgqzkfhygkhdkllsdjqxpqykybnqsxqnszswhbsxwhxwbzzxdmnsjbsbkbbzklylxgwxdrwyqzmywsjqlcj"
-"xxjxkjeqxscyetlzhlyyysdzpaqyzcmtlshtzcfyzyxyljsdcjqagyslcqlyyyshmrqqkldxzscsssydycjysfsjbfrsszqsbxxp"
-"xjysdrckgjlgdkzjzbdktcsyqpyhstcldjdhmxmcgxyzhjddtmhltxzxylymohyjcltyfbqqxpfbdfhhtksqhzyywcnxxcrwhowg"
-"yjlegwdqcwgfjycsntmytolbygwqwesjpwnmlrydzsztxyqpzgcwxhngpyxshmyqjxztdppbfyhzhtjyfdzwkgkzbldntsxhqeeg"
-"zzylzmmzyjzgxzxkhkstxnxxwylyapsthxdwhzympxagkydxbhnhxkdpjnmyhylpmgocslnzhkxxlpzzlbmlsfbhhgygyyggbhsc"
-"yaqtywlxtzqcezydqdqmmhtkllszhlsjzwfyhqswscwlqazynytlsxthaznkzzszzlaxxzwwctgqqtddyztcchyqzflxpslzygpz"
-"sznglndqtbdlxgtctajdkywnsyzljhhzzcwnyyzywmhychhyxhjkzwsxhzyxlyskqyspslyzwmyppkbyglkzhtyxaxqsyshxasmc"
-"hkdscrswjpwxsgzjlwwschsjhsqnhcsegndaqtbaalzzmsstdqjcjktscjaxplggxhhgxxzcxpdmmhldgtybysjmxhmrcpxxjzck"
-"zxshmlqxxtthxwzfkhcczdytcjyxqhlxdhypjqxylsyydzozjnyxqezysqyayxwypdgxddxsppyzndltwrhxydxzzjhtcxmczlhp"
-"yyyymhzllhnxmylllmdcppxhmxdkycyrdltxjchhzzxzlcclylnzshzjzzlnnrlwhyqsnjhxyntttkyjpychhyegkcttwlgqrlgg"
-"tgtygyhpyhylqyqgcwyqkpyyyttttlhyhlltyttsplkyzxgzwgpydsszzdqxskcqnmjjzzbxyqmjrtffbtkhzkbxljjkdxjtlbwf"
-"zpptkqtztgpdgntpjyfalqmkgxbdclzfhzclllladpmxdjhlcclgyhdzfgyddgcyyfgydxkssebdhykdkdkhnaxxybpbyyhxzqga"
-"ffqyjxdmljcsqzllpchbsxgjyndybyqspzwjlzksddtactbxzdyzypjzqsjnkktknjdjgyypgtlfyqkasdntcyhblwdzhbbydwjr"
-"ygkzyheyyfjmsdtyfzjjhgcxplxhldwxxjkytcyksssmtwcttqzlpbszdzwzxgzagyktywxlhlspbclloqmmzsslcmbjcszzkydc"
-"zjgqqdsmcytzqqlwzqzxssfpttfqmddzdshdtdwfhtdyzjyqjqkypbdjyyxtljhdrqxxxhaydhrjlklytwhllrllrcxylbwsrszz"
-"symkzzhhkyhxksmdsydycjpbzbsqlfcxxxnxkxwywsdzyqoggqmmyhcdzttfjyybgstttybykjdhkyxbelhtypjqnfxfdykzhqkz"
-"byjtzbxhfdxkdaswtawajldyjsfhbldnntnqjtjnchxfjsrfwhzfmdryjyjwzpdjkzyjympcyznynxfbytfyfwygdbnzzzdnytxz"
-"emmqbsqehxfzmbmflzzsrxymjgsxwzjsprydjsjgxhjjgljjynzzjxhgxkymlpyyycxytwqzswhwlyrjlpxslsxmfswwklctnxny"
-"npsjszhdzeptxmyywxyysywlxjqzqxzdcleeelmcpjpclwbxsqhfwwtffjtnqjhjqdxhwlbyznfjlalkyyjldxhhycstyywnrjyx"
-"ywtrmdrqhwqcmfjdyzmhmyyxjwmyzqzxtlmrspwwchaqbxygzypxyyrrclmpymgksjszysrmyjsnxtplnbappypylxyyzkynldzy"
-"jzcznnlmzhharqmpgwqtzmxxmllhgdzxyhxkyxycjmffyyhjfsbssqlxxndycannmtcjcyprrnytyqnyymbmsxndlylysljrlxys"
-"xqmllyzlzjjjkyzzcsfbzxxmstbjgnxyzhlxnmcwscyzyfzlxbrnnnylbnrtgzqysatswryhyjzmzdhzgzdwybsscskxsyhytxxg"
-"cqgxzzshyxjscrhmkkbxczjyjymkqhzjfnbhmqhysnjnzybknqmclgqhwlznzswxkhljhyybqlbfcdsxdldspfzpskjyzwzxzddx"
-"jsmmegjscssmgclxxkyyylnypwwwgydkzjgggzggsycknjwnjpcxbjjtqtjwdsspjxzxnzxumelpxfsxtllxcljxjjljzxctpswx"
-"lydhlyqrwhsycsqyybyaywjjjqfwqcqqcjqgxaldbzzyjgkgxpltzyfxjltpadkyqhpmatlcpdckbmtxybhklenxdleegqdymsaw"
-"hzmljtwygxlyqzljeeyybqqffnlyxrdsctgjgxyynkllyqkcctlhjlqmkkzgcyygllljdzgydhzwxpysjbzkdzgyzzhywyfqytyz"
-"szyezzlymhjjhtsmqwyzlkyywzcsrkqytltdxwctyjklwsqzwbdcqyncjsrszjlkcdcdtlzzzacqqzzddxyplxzbqjylzlllqddz"
-"qjyjyjzyxnyyynyjxkxdazwyrdljyyyrjlxlldyxjcywywnqcclddnyyynyckczhxxcclgzqjgkwppcqqjysbzzxyjsqpxjpzbsb"
-"dsfnsfpzxhdwztdwpptflzzbzdmyypqjrsdzsqzsqxbdgcpzswdwcsqzgmdhzxmwwfybpdgphtmjthzsmmbgzmbzjcfzwfzbbzmq"
-"cfmbdmcjxlgpnjbbxgyhyyjgptzgzmqbqtcgyxjxlwzkydpdymgcftpfxyztzxdzxtgkmtybbclbjaskytssqyymszxfjewlxlls"
-"zbqjjjaklylxlycctsxmcwfkkkbsxlllljyxtyltjyytdpjhnhnnkbyqnfqyyzbyyessessgdyhfhwtcjbsdzztfdmxhcnjzymqw"
-"sryjdzjqpdqbbstjggfbkjbxtgqhngwjxjgdllthzhhyyyyyysxwtyyyccbdbpypzycczyjpzywcbdlfwzcwjdxxhyhlhwzzxjtc"
-"zlcdpxujczzzlyxjjtxphfxwpywxzptdzzbdzcyhjhmlxbqxsbylrdtgjrrcttthytczwmxfytwwzcwjwxjywcskybzscctzqnhx"
-"nwxxkhkfhtswoccjybcmpzzykbnnzpbzhhzdlsyddytyfjpxyngfxbyqxcbhxcpsxtyzdmkysnxsxlhkmzxlyhdhkwhxxsskqyhh"
-"cjyxglhzxcsnhekdtgzxqypkdhextykcnymyyypkqyyykxzlthjqtbyqhxbmyhsqckwwyllhcyylnneqxqwmcfbdccmljggxdqkt"
-"lxkgnqcdgzjwyjjlyhhqtttnwchmxcxwhwszjydjccdbqcdgdnyxzthcqrxcbhztqcbxwgqwyybxhmbymyqtyexmqkyaqyrgyzsl"
-"fykkqhyssqyshjgjcnxkzycxsbxyxhyylstycxqthysmgscpmmgcccccmtztasmgqzjhklosqylswtmxsyqkdzljqqyplsycztcq"
-"qpbbqjzclpkhqzyyxxdtddtsjcxffllchqxmjlwcjcxtspycxndtjshjwxdqqjskxyamylsjhmlalykxcyydmnmdqmxmcznncybz"
-"kkyflmchcmlhxrcjjhsylnmtjzgzgywjxsrxcwjgjqhqzdqjdcjjzkjkgdzqgjjyjylxzxxcdqhhheytmhlfsbdjsyyshfystczq"
-"lpbdrfrztzykywhszyqkwdqzrkmsynbcrxqbjyfazpzzedzcjywbcjwhyjbqszywryszptdkzpfpbnztklqyhbbzpnpptyzzybqn"
-"ydcpjmmcycqmcyfzzdcmnlfpbplngqjtbttnjzpzbbznjkljqylnbzqhksjznggqszzkyxshpzsnbcgzkddzqanzhjkdrtlzlswj"
-"ljzlywtjndjzjhxyayncbgtzcssqmnjpjytyswxzfkwjqtkhtzplbhsnjzsyzbwzzzzlsylsbjhdwwqpslmmfbjdwaqyztcjtbnn"
-"wzxqxcdslqgdsdpdzhjtqqpswlyyjzlgyxyzlctcbjtktyczjtqkbsjlgmgzdmcsgpynjzyqyyknxrpwszxmtncszzyxybyhyzax"
-"ywqcjtllckjjtjhgdxdxyqyzzbywdlwqcglzgjgqrqzczssbcrpcskydznxjsqgxssjmydnstztpbdltkzwxqwqtzexnqczgwezk"
-"ssbybrtssslccgbpszqszlccglllzxhzqthczmqgyzqznmcocszjmmzsqpjygqljyjppldxrgzyxccsxhshgtznlzwzkjcxtcfcj"
-"xlbmqbczzwpqdnhxljcthyzlgylnlszzpcxdscqqhjqksxzpbajyemsmjtzdxlcjyryynwjbngzztmjxltbslyrzpylsscnxphll"
-"hyllqqzqlxymrsycxzlmmczltzsdwtjjllnzggqxpfskygyghbfzpdkmwghcxmsgdxjmcjzdycabxjdlnbcdqygskydqtxdjjyxm"
-"szqazdzfslqxyjsjzylbtxxwxqqzbjzufbblylwdsljhxjyzjwtdjczfqzqzzdzsxzzqlzcdzfjhyspympqzmlpplffxjjnzzyls"
-"jeyqzfpfzksywjjjhrdjzzxtxxglghydxcskyswmmzcwybazbjkshfhjcxmhfqhyxxyzftsjyzfxyxpzlchmzmbxhzzsxyfymncw"
-"dabazlxktcshhxkxjjzjsthygxsxyyhhhjwxkzxssbzzwhhhcwtzzzpjxsnxqqjgzyzywllcwxzfxxyxyhxmkyyswsqmnlnaycys"
-"pmjkhwcqhylajjmzxhmmcnzhbhxclxtjpltxyjhdyylttxfszhyxxsjbjyayrsmxyplckduyhlxrlnllstyzyyqygyhhsccsmzct"
-"zqxkyqfpyyrpfflkquntszllzmwwtcqqyzwtllmlmpwmbzsstzrbpddtlqjjbxzcsrzqqygwcsxfwzlxccrszdzmcyggdzqsgtjs"
-"wljmymmzyhfbjdgyxccpshxnzcsbsjyjgjmppwaffyfnxhyzxzylremzgzcyzsszdlljcsqfnxzkptxzgxjjgfmyyysnbtylbnlh"
-"pfzdcyfbmgqrrssszxysgtzrnydzzcdgpjafjfzknzblczszpsgcycjszlmlrszbzzldlsllysxsqzqlyxzlskkbrxbrbzcycxzz"
-"zeeyfgklzlyyhgzsgzlfjhgtgwkraajyzkzqtsshjjxdcyzuyjlzyrzdqqhgjzxsszbykjpbfrtjxllfqwjhylqtymblpzdxtzyg"
-"bdhzzrbgxhwnjtjxlkscfsmwlsdqysjtxkzscfwjlbxftzlljzllqblsqmqqcgczfpbphzczjlpyyggdtgwdcfczqyyyqyssclxz"
-"sklzzzgffcqnwglhqyzjjczlqzzyjpjzzbpdccmhjgxdqdgdlzqmfgpsytsdyfwwdjzjysxyyczcyhzwpbykxrylybhkjksfxtzj"
-"mmckhlltnyymsyxyzpyjqycsycwmtjjkqyrhllqxpsgtlyycljscpxjyzfnmlrgjjtyzbxyzmsjyjhhfzqmsyxrszcwtlrtqzsst"
-"kxgqkgsptgcznjsjcqcxhmxggztqydjkzdlbzsxjlhyqgggthqszpyhjhhgyygkggcwjzzylczlxqsftgzslllmljskctbllzzsz"
-"mmnytpzsxqhjcjyqxyzxzqzcpshkzzysxcdfgmwqrllqxrfztlystctmjcxjjxhjnxtnrztzfqyhqgllgcxszsjdjljcydsjtlny"
-"xhszxcgjzyqpylfhdjsbpcczhjjjqzjqdybssllcmyttmqtbhjqnnygkyrqyqmzgcjkpdcgmyzhqllsllclmholzgdyyfzsljcqz"
-"lylzqjeshnylljxgjxlysyyyxnbzljsszcqqcjyllzltjyllzllbnylgqchxyyxoxcxqkyjxxxyklxsxxyqxcykqxqcsgyxxyqxy"
-"gytqohxhxpyxxxulcyeychzzcbwqbbwjqzscszsslzylkdesjzwmymcytsdsxxscjpqqsqylyyzycmdjdzywcbtjsydjkcyddjlb"
-"djjsodzysyxqqyxdhhgqqyqhdyxwgmmmajdybbbppbcmuupljzsmtxerxjmhqnutpjdcbssmssstkjtssmmtrcplzszmlqdsdmjm"
-"qpnqdxcfynbfsdqxyxhyaykqyddlqyyysszbydslntfqtzqpzmchdhczcwfdxtmyqsphqyyxsrgjcwtjtzzqmgwjjtjhtqjbbhwz"
-"pxxhyqfxxqywyyhyscdydhhqmnmtmwcpbszppzzglmzfollcfwhmmsjzttdhzzyffytzzgzyskyjxqyjzqbhmbzzlyghgfmshpzf"
-"zsnclpbqsnjxzslxxfpmtyjygbxlldlxpzjyzjyhhzcywhjylsjexfszzywxkzjluydtmlymqjpwxyhxsktqjezrpxxzhhmhwqpw"
-"qlyjjqjjzszcphjlchhnxjlqwzjhbmzyxbdhhypzlhlhlgfwlchyytlhjxcjmscpxstkpnhqxsrtyxxtesyjctlsslstdlllwwyh"
-"dhrjzsfgxtsyczynyhtdhwjslhtzdqdjzxxqhgyltzphcsqfclnjtclzpfstpdynylgmjllycqhysshchylhqyqtmzypbywrfqyk"
-"qsyslzdqjmpxyyssrhzjnywtqdfzbwwtwwrxcwhgyhxmkmyyyqmsmzhngcepmlqqmtcwctmmpxjpjjhfxyyzsxzhtybmstsyjttq"
-"qqyylhynpyqzlcyzhzwsmylkfjxlwgxypjytysyxymzckttwlksmzsylmpwlzwxwqzssaqsyxyrhssntsrapxcpwcmgdxhxzdzyf"
-"jhgzttsbjhgyzszysmyclllxbtyxhbbzjkssdmalxhycfygmqypjycqxjllljgslzgqlycjcczotyxmtmttllwtgpxymzmklpszz"
-"zxhkqysxctyjzyhxshyxzkxlzwpsqpyhjwpjpwxqqylxsdhmrslzzyzwttcyxyszzshbsccstplwsscjchnlcgchssphylhfhhxj"
-"sxyllnylszdhzxylsxlwzykcldyaxzcmddyspjtqjzlnwqpssswctstszlblnxsmnyymjqbqhrzwtyydchqlxkpzwbgqybkfcmzw"
-"pzllyylszydwhxpsbcmljbscgbhxlqhyrljxyswxwxzsldfhlslynjlzyflyjycdrjlfsyzfsllcqyqfgjyhyxzlylmstdjcyhbz"
-"llnwlxxygyyhsmgdhxxhhlzzjzxczzzcyqzfngwpylcpkpyypmclqkdgxzggwqbdxzzkzfbxxlzxjtpjpttbytszzdwslchzhslt"
-"yxhqlhyxxxyyzyswtxzkhlxzxzpyhgchkcfsyhutjrlxfjxptztwhplyxfcrhxshxkyxxyhzqdxqwulhyhmjtbflkhtxcwhjfwjc"
-"fpqryqxcyyyqygrpywsgsungwchkzdxyflxxhjjbyzwtsxxncyjjymswzjqrmhxzwfqsylzjzgbhynslbgttcsybyxxwxyhxyyxn"
-"sqyxmqywrgyqlxbbzljsylpsytjzyhyzawlrorjmksczjxxxyxchdyxryxxjdtsqfxlyltsffyxlmtyjmjuyyyxltzcsxqzqhzxl"
-"yyxzhdnbrxxxjctyhlbrlmbrllaxkyllljlyxxlycrylcjtgjcmtlzllcyzzpzpcyawhjjfybdyyzsmpckzdqyqpbpcjpdcyzmdp"
-"bcyydycnnplmtmlrmfmmgwyzbsjgygsmzqqqztxmkqwgxllpjgzbqcdjjjfpkjkcxbljmswmdtqjxldlppbxcwrcqfbfqjczahzg"
-"mykphyyhzykndkzmbpjyxpxyhlfpnyygxjdbkxnxhjmzjxstrstldxskzysybzxjlxyslbzyslhxjpfxpqnbylljqkygzmcyzzym"
-"ccslclhzfwfwyxzmwsxtynxjhpyymcyspmhysmydyshqyzchmjjmzcaagcfjbbhplyzylxxsdjgxdhkxxtxxnbhrmlyjsltxmrhn"
-"lxqjxyzllyswqgdlbjhdcgjyqycmhwfmjybmbyjyjwymdpwhxqldygpdfxxbcgjspckrssyzjmslbzzjfljjjlgxzgyxyxlszqyx"
-"bexyxhgcxbpldyhwettwwcjmbtxchxyqxllxflyxlljlssfwdpzsmyjclmwytczpchqekcqbwlcqydplqppqzqfjqdjhymmcxtxd"
-"rmjwrhxcjzylqxdyynhyyhrslsrsywwzjymtltllgtqcjzyabtckzcjyccqljzqxalmzyhywlwdxzxqdllqshgpjfjljhjabcqzd"
-"jgtkhsstcyjlpswzlxzxrwgldlzrlzxtgsllllzlyxxwgdzygbdphzpbrlwsxqbpfdwofmwhlypcbjccldmbzpbzzlcyqxldomzb"
-"lzwpdwyygdstthcsqsccrsssyslfybfntyjszdfndpdhdzzmbblslcmyffgtjjqwftmtpjwfnlbzcmmjtgbdzlqlpyfhyymjylsd"
-"chdzjwjcctljcldtljjcpddsqdsszybndbjlggjzxsxnlycybjxqycbylzcfzppgkcxzdzfztjjfjsjxzbnzyjqttyjyhtyczhym"
-"djxttmpxsplzcdwslshxypzgtfmlcjtycbpmgdkwycyzcdszzyhflyctygwhkjyylsjcxgywjcbllcsnddbtzbsclyzczzssqdll"
-"mqyyhfslqllxftyhabxgwnywyypllsdldllbjcyxjzmlhljdxyyqytdlllbugbfdfbbqjzzmdpjhgclgmjjpgaehhbwcqxaxhhhz"
-"chxyphjaxhlphjpgpzjqcqzgjjzzuzdmqyybzzphyhybwhazyjhykfgdpfqsdlzmljxkxgalxzdaglmdgxmwzqyxxdxxpfdmmssy"
-"mpfmdmmkxksyzyshdzkxsysmmzzzmsydnzzczxfplstmzdnmxckjmztyymzmzzmsxhhdczjemxxkljstlwlsqlyjzllzjssdppmh"
-"nlzjczyhmxxhgzcjmdhxtkgrmxfwmcgmwkdtksxqmmmfzzydkmsclcmpcgmhspxqpzdsslcxkyxtwlwjyahzjgzqmcsnxyymmpml"
-"kjxmhlmlqmxctkzmjqyszjsyszhsyjzjcdajzybsdqjzgwzqqxfkdmsdjlfwehkzqkjpeypzyszcdwyjffmzzylttdzzefmzlbnp"
-"plplpepszalltylkckqzkgenqlwagyxydpxlhsxqqwqcqxqclhyxxmlyccwlymqyskgchlcjnszkpyzkcqzqljpdmdzhlasxlbyd"
-"wqlwdnbqcryddztjybkbwszdxdtnpjdtctqdfxqqmgnxeclttbkpwslctyqlpwyzzklpygzcqqpllkccylpqmzczqcljslqzdjxl"
-"ddhpzqdljjxzqdxyzqkzljcyqdyjppypqykjyrmpcbymcxkllzllfqpylllmbsglcysslrsysqtmxyxzqzfdzuysyztffmzzsmzq"
-"hzssccmlyxwtpzgxzjgzgsjsgkddhtqggzllbjdzlcbchyxyzhzfywxyzymsdbzzyjgtsmtfxqyxqstdgslnxdlryzzlryylxqht"
-"xsrtzngzxbnqqzfmykmzjbzymkbpnlyzpblmcnqyzzzsjzhjctzkhyzzjrdyzhnpxglfztlkgjtctssyllgzrzbbqzzklpklczys"
-"suyxbjfpnjzzxcdwxzyjxzzdjjkggrsrjkmsmzjlsjywqskyhqjsxpjzzzlsnshrnypztwchklpsrzlzxyjqxqkysjycztlqzybb"
-"ybwzpqdwwyzcytjcjxckcwdkkzxsgkdzxwwyyjqyytcytdllxwkczkklcclzcqqdzlqlcsfqchqhsfsmqzzlnbjjzbsjhtszdysj"
-"qjpdlzcdcwjkjzzlpycgmzwdjjbsjqzsyzyhhxjpbjydssxdzncglqmbtsfsbpdzdlznfgfjgfsmpxjqlmblgqcyyxbqkdjjqyrf"
-"kztjdhczklbsdzcfjtplljgxhyxzcsszzxstjygkgckgyoqxjplzpbpgtgyjzghzqzzlbjlsqfzgkqqjzgyczbzqtldxrjxbsxxp"
-"zxhyzyclwdxjjhxmfdzpfzhqhqmqgkslyhtycgfrzgnqxclpdlbzcsczqlljblhbzcypzzppdymzzsgyhckcpzjgsljlnscdsldl"
-"xbmstlddfjmkdjdhzlzxlszqpqpgjllybdszgqlbzlslkyyhzttntjyqtzzpszqztlljtyyllqllqyzqlbdzlslyyzymdfszsnhl"
-"xznczqzpbwskrfbsyzmthblgjpmczzlstlxshtcsyzlzblfeqhlxflcjlyljqcbzlzjhhsstbrmhxzhjzclxfnbgxgtqjcztmsfz"
-"kjmssnxljkbhsjxntnlzdntlmsjxgzjyjczxyjyjwrwwqnztnfjszpzshzjfyrdjsfszjzbjfzqzzhzlxfysbzqlzsgyftzdcszx"
-"zjbqmszkjrhyjzckmjkhchgtxkxqglxpxfxtrtylxjxhdtsjxhjzjxzwzlcqsbtxwxgxtxxhxftsdkfjhzyjfjxrzsdllltqsqqz"
-"qwzxsyqtwgwbzcgzllyzbclmqqtzhzxzxljfrmyzflxysqxxjkxrmqdzdmmyybsqbhgzmwfwxgmxlzpyytgzyccdxyzxywgsyjyz"
-"nbhpzjsqsyxsxrtfyzgrhztxszzthcbfclsyxzlzqmzlmplmxzjxsflbyzmyqhxjsxrxsqzzzsslyfrczjrcrxhhzxqydyhxsjjh"
-"zcxzbtynsysxjbqlpxzqpymlxzkyxlxcjlcysxxzzlxdllljjyhzxgyjwkjrwyhcpsgnrzlfzwfzznsxgxflzsxzzzbfcsyjdbrj"
-"krdhhgxjljjtgxjxxstjtjxlyxqfcsgswmsbctlqzzwlzzkxjmltmjyhsddbxgzhdlbmyjfrzfsgclyjbpmlysmsxlszjqqhjzfx"
-"gfqfqbpxzgyyqxgztcqwyltlgwsgwhrlfsfgzjmgmgbgtjfsyzzgzyzaflsspmlpflcwbjzcljjmzlpjjlymqdmyyyfbgygyzmly"
-"zdxqyxrqqqhsyyyqxyljtyxfsfsllgnqcyhycwfhcccfxpylypllzyxxxxxkqhhxshjzcfzsczjxcpzwhhhhhapylqalpqafyhxd"
-"ylukmzqgggddesrnnzltzgchyppysqjjhclljtolnjpzljlhymheydydsqycddhgzundzclzyzllzntnyzgslhslpjjbdgwxpcdu"
-"tjcklkclwkllcasstkzzdnqnttlyyzssysszzryljqkcqdhhcrxrzydgrgcwcgzqfffppjfzynakrgywyqpqxxfkjtszzxswzddf"
-"bbxtbgtzkznpzzpzxzpjszbmqhkcyxyldkljnypkyghgdzjxxeahpnzkztzcmxcxmmjxnkszqnmnlwbwwxjkyhcpstmcsqtzjyxt"
-"pctpdtnnpglllzsjlspblplqhdtnjnlyyrszffjfqwdphzdwmrzcclodaxnssnyzrestyjwjyjdbcfxnmwttbylwstszgybljpxg"
-"lboclhpcbjltmxzljylzxcltpnclckxtpzjswcyxsfyszdkntlbyjcyjllstgqcbxryzxbxklylhzlqzlnzcxwjzljzjncjhxmnz"
-"zgjzzxtzjxycyycxxjyyxjjxsssjstssttppgqtcsxwzdcsyfptfbfhfbblzjclzzdbxgcxlqpxkfzflsyltuwbmqjhszbmddbcy"
-"sccldxycddqlyjjwmqllcsgljjsyfpyyccyltjantjjpwycmmgqyysxdxqmzhszxpftwwzqswqrfkjlzjqqyfbrxjhhfwjjzyqaz"
-"myfrhcyybyqwlpexcczstyrlttdmqlykmbbgmyyjprkznpbsxyxbhyzdjdnghpmfsgmwfzmfqmmbcmzzcjjlcnuxyqlmlrygqzcy"
-"xzlwjgcjcggmcjnfyzzjhycprrcmtzqzxhfqgtjxccjeaqcrjyhplqlszdjrbcqhqdyrhylyxjsymhzydwldfryhbpydtsscnwbx"
-"glpzmlzztqsscpjmxxycsjytycghycjwyrxxlfemwjnmkllswtxhyyyncmmcwjdqdjzglljwjrkhpzggflccsczmcbltbhbqjxqd"
-"spdjzzgkglfqywbzyzjltstdhqhctcbchflqmpwdshyytqwcnzzjtlbymbpdyyyxsqkxwyyflxxncwcxypmaelykkjmzzzbrxyyq"
-"jfljpfhhhytzzxsgqqmhspgdzqwbwpjhzjdyscqwzktxxsqlzyymysdzgrxckkujlwpysyscsyzlrmlqsyljxbcxtlwdqzpcycyk"
-"pppnsxfyzjjrcemhszmsxlxglrwgcstlrsxbzgbzgztcplujlslylymtxmtzpalzxpxjtjwtcyyzlblxbzlqmylxpghdslssdmxm"
-"bdzzsxwhamlczcpjmcnhjysnsygchskqmzzqdllkablwjxsfmocdxjrrlyqzkjmybyqlyhetfjzfrfksryxfjtwdsxxsysqjysly"
-"xwjhsnlxyyxhbhawhhjzxwmyljcsslkydztxbzsyfdxgxzjkhsxxybssxdpynzwrptqzczenygcxqfjykjbzmljcmqqxuoxslyxx"
-"lylljdzbtymhpfsttqqwlhokyblzzalzxqlhzwrrqhlstmypyxjjxmqsjfnbxyxyjxxyqylthylqyfmlkljtmllhszwkzhljmlhl"
-"jkljstlqxylmbhhlnlzxqjhxcfxxlhyhjjgbyzzkbxscqdjqdsujzyyhzhhmgsxcsymxfebcqwwrbpyyjqtyzcyqyqqzyhmwffhg"
-"zfrjfcdpxntqyzpdykhjlfrzxppxzdbbgzqstlgdgylcqmlchhmfywlzyxkjlypqhsywmqqgqzmlzjnsqxjqsyjycbehsxfszpxz"
-"wfllbcyyjdytdthwzsfjmqqyjlmqxxlldttkhhybfpwtyysqqwnqwlgwdebzwcmygculkjxtmxmyjsxhybrwfymwfrxyqmxysztz"
-"ztfykmldhqdxwyynlcryjblpsxcxywlsprrjwxhqyphtydnxhhmmywytzcsqmtssccdalwztcpqpyjllqzyjswxmzzmmylmxclmx"
-"czmxmzsqtzppqqblpgxqzhfljjhytjsrxwzxsccdlxtyjdcqjxslqyclzxlzzxmxqrjmhrhzjbhmfljlmlclqnldxzlllpypsyjy"
-"sxcqqdcmqjzzxhnpnxzmekmxhykyqlxsxtxjyyhwdcwdzhqyybgybcyscfgpsjnzdyzzjzxrzrqjjymcanyrjtldppyzbstjkxxz"
-"ypfdwfgzzrpymtngxzqbyxnbufnqkrjqzmjegrzgyclkxzdskknsxkcljspjyyzlqqjybzssqlllkjxtbktylccddblsppfylgyd"
-"tzjyqggkqttfzxbdktyyhybbfytyybclpdytgdhryrnjsptcsnyjqhklllzslydxxwbcjqspxbpjzjcjdzffxxbrmlazhcsndlbj"
-"dszblprztswsbxbcllxxlzdjzsjpylyxxyftfffbhjjxgbyxjpmmmpssjzjmtlyzjxswxtyledqpjmygqzjgdjlqjwjqllsjgjgy"
-"gmscljjxdtygjqjqjcjzcjgdzzsxqgsjggcxhqxsnqlzzbxhsgzxcxyljxyxyydfqqjhjfxdhctxjyrxysqtjxyefyyssyyjxncy"
-"zxfxmsyszxyyschshxzzzgzzzgfjdltylnpzgyjyzyyqzpbxqbdztzczyxxyhhsqxshdhgqhjhgywsztmzmlhyxgebtylzkqwytj"
-"zrclekystdbcykqqsayxcjxwwgsbhjyzydhcsjkqcxswxfltynyzpzcczjqtzwjqdzzzqzljjxlsbhpyxxpsxshheztxfptlqyzz"
-"xhytxncfzyyhxgnxmywxtzsjpthhgymxmxqzxtsbczyjyxxtyyzypcqlmmszmjzzllzxgxzaajzyxjmzxwdxzsxzdzxleyjjzqbh"
-"zwzzzqtzpsxztdsxjjjznyazphxyysrnqdthzhyykyjhdzxzlswclybzyecwcycrylcxnhzydzydyjdfrjjhtrsqtxyxjrjhojyn"
-"xelxsfsfjzghpzsxzszdzcqzbyyklsgsjhczshdgqgxyzgxchxzjwyqwgyhksseqzzndzfkwysstclzstsymcdhjxxyweyxczayd"
-"mpxmdsxybsqmjmzjmtzqlpjyqzcgqhxjhhlxxhlhdldjqcldwbsxfzzyyschtytyybhecxhykgjpxhhyzjfxhwhbdzfyzbcapnpg"
-"nydmsxhmmmmamynbyjtmpxyymcthjbzyfcgtyhwphftwzzezsbzegpfmtskftycmhfllhgpzjxzjgzjyxzsbbqsczzlzccstpgxm"
-"jsftcczjzdjxcybzlfcjsyzfgszlybcwzzbyzdzypswyjzxzbdsyuxlzzbzfygczxbzhzftpbgzgejbstgkdmfhyzzjhzllzzgjq"
-"zlsfdjsscbzgpdlfzfzszyzyzsygcxsnxxchczxtzzljfzgqsqyxzjqdccztqcdxzjyqjqchxztdlgscxzsyqjqtzwlqdqztqchq"
-"qjzyezzzpbwkdjfcjpztypqyqttynlmbdktjzpqzqzzfpzsbnjlgyjdxjdzzkzgqkxdlpzjtcjdqbxdjqjstcknxbxzmslyjcqmt"
-"jqwwcjqnjnlllhjcwqtbzqydzczpzzdzyddcyzzzccjttjfzdprrtztjdcqtqzdtjnplzbcllctzsxkjzqzpzlbzrbtjdcxfczdb"
-"ccjjltqqpldcgzdbbzjcqdcjwynllzyzccdwllxwzlxrxntqqczxkqlsgdfqtddglrlajjtkuymkqlltzytdyyczgjwyxdxfrsks"
-"tqtenqmrkqzhhqkdldazfkypbggpzrebzzykzzspegjxgykqzzzslysyyyzwfqzylzzlzhwchkypqgnpgblplrrjyxccsyyhsfzf"
-"ybzyytgzxylxczwxxzjzblfflgskhyjzeyjhlpllllczgxdrzelrhgklzzyhzlyqszzjzqljzflnbhgwlczcfjyspyxzlzlxgccp"
-"zbllcybbbbubbcbpcrnnzczyrbfsrldcgqyyqxygmqzwtzytyjxyfwtehzzjywlccntzyjjzdedpzdztsyqjhdymbjnyjzlxtsst"
-"phndjxxbyxqtzqddtjtdyytgwscszqflshlglbczphdlyzjyckwtytylbnytsdsycctyszyyebhexhqdtwnygyclxtszystqmygz"
-"azccszzdslzclzrqxyyeljsbymxsxztembbllyyllytdqyshymrqwkfkbfxnxsbychxbwjyhtqbpbsbwdzylkgzskyhxqzjxhxjx"
-"gnljkzlyycdxlfyfghljgjybxqlybxqpqgztzplncypxdjyqydymrbesjyyhkxxstmxrczzywxyqybmcllyzhqyzwqxdbxbzwzms"
-"lpdmyskfmzklzcyqyczlqxfzzydqzpzygyjyzmzxdzfyfyttqtzhgspczmlccytzxjcytjmkslpzhysnzllytpzctzzcktxdhxxt"
-"qcyfksmqccyyazhtjpcylzlyjbjxtpnyljyynrxsylmmnxjsmybcsysylzylxjjqyldzlpqbfzzblfndxqkczfywhgqmrdsxycyt"
-"xnqqjzyypfzxdyzfprxejdgyqbxrcnfyyqpghyjdyzxgrhtkylnwdzntsmpklbthbpyszbztjzszzjtyyxzphsszzbzczptqfzmy"
-"flypybbjqxzmxxdjmtsyskkbjzxhjcklpsmkyjzcxtmljyxrzzqslxxqpyzxmkyxxxjcljprmyygadyskqlsndhyzkqxzyztcghz"
-"tlmlwzybwsyctbhjhjfcwztxwytkzlxqshlyjzjxtmplpycgltbzztlzjcyjgdtclklpllqpjmzpapxyzlkktkdzczzbnzdydyqz"
-"jyjgmctxltgxszlmlhbglkfwnwzhdxuhlfmkyslgxdtwwfrjejztzhydxykshwfzcqshktmqqhtzhymjdjskhxzjzbzzxympagqm"
-"stpxlsklzynwrtsqlszbpspsgzwyhtlkssswhzzlyytnxjgmjszsufwnlsoztxgxlsammlbwldszylakqcqctmycfjbslxclzzcl"
-"xxksbzqclhjpsqplsxxckslnhpsfqqytxyjzlqldxzqjzdyydjnzptuzdskjfsljhylzsqzlbtxydgtqfdbyazxdzhzjnhhqbykn"
-"xjjqczmlljzkspldyclbblxklelxjlbqycxjxgcnlcqplzlzyjtzljgyzdzpltqcsxfdmnycxgbtjdcznbgbqyqjwgkfhtnpyqzq"
-"gbkpbbyzmtjdytblsqmpsxtbnpdxklemyycjynzctldykzzxddxhqshdgmzsjycctayrzlpyltlkxslzcggexclfxlkjrtlqjaqz"
-"ncmbydkkcxglczjzxjhptdjjmzqykqsecqzdshhadmlzfmmzbgntjnnlgbyjbrbtmlbyjdzxlcjlpldlpcqdhlxzlycblcxzzjad"
-"jlnzmmsssmybhbsqkbhrsxxjmxsdznzpxlgbrhwggfcxgmsklltsjyycqltskywyyhywxbxqywpywykqlsqptntkhqcwdqktwpxx"
-"hcpthtwumssyhbwcrwxhjmkmzngwtmlkfghkjylsyycxwhyeclqhkqhttqkhfzldxqwyzyydesbpkyrzpjfyyzjceqdzzdlatzbb"
-"fjllcxdlmjssxegygsjqxcwbxsszpdyzcxdnyxppzydlyjczpltxlsxyzyrxcyyydylwwnzsahjsyqyhgywwaxtjzdaxysrltdps"
-"syyfnejdxyzhlxlllzqzsjnyqyqqxyjghzgzcyjchzlycdshwshjzyjxcllnxzjjyyxnfxmwfpylcyllabwddhwdxjmcxztzpmlq"
-"zhsfhzynztlldywlslxhymmylmbwwkyxyadtxylldjpybpwuxjmwmllsafdllyflbhhhbqqltzjcqjldjtffkmmmbythygdcqrdd"
-"wrqjxnbysnwzdbyytbjhpybyttjxaahgqdqtmystqxkbtzpkjlzrbeqqssmjjbdjotgtbxpgbktlhqxjjjcthxqdwjlwrfwqgwsh"
-"ckryswgftgygbxsdwdwrfhwytjjxxxjyzyslpyyypayxhydqkxshxyxgskqhywfdddpplcjlqqeewxksyykdypltjthkjltcyyhh"
-"jttpltzzcdlthqkzxqysteeywyyzyxxyysttjkllpzmcyhqgxyhsrmbxpllnqydqhxsxxwgdqbshyllpjjjthyjkyppthyyktyez"
-"yenmdshlcrpqfdgfxzpsftljxxjbswyysksflxlpplbbblbsfxfyzbsjssylpbbffffsscjdstzsxzryysyffsyzyzbjtbctsbsd"
-"hrtjjbytcxyjeylxcbnebjdsyxykgsjzbxbytfzwgenyhhthzhhxfwgcstbgxklsxywmtmbyxjstzscdyqrcytwxzfhmymcxlzns"
-"djtttxrycfyjsbsdyerxjljxbbdeynjghxgckgscymblxjmsznskgxfbnbpthfjaafxyxfpxmypqdtzcxzzpxrsywzdlybbktyqp"
-"qjpzypzjznjpzjlzzfysbttslmptzrtdxqsjehbzylzdhljsqmlhtxtjecxslzzspktlzkqqyfsygywpcpqfhqhytqxzkrsgttsq"
-"czlptxcdyyzxsqzslxlzmycpcqbzyxhbsxlzdltcdxtylzjyyzpzyzltxjsjxhlpmytxcqrblzssfjzztnjytxmyjhlhpplcyxqj"
-"qqkzzscpzkswalqsblcczjsxgwwwygyktjbbztdkhxhkgtgpbkqyslpxpjckbmllxdzstbklggqkqlsbkktfxrmdkbftpzfrtbbr"
-"ferqgxyjpzsstlbztpszqzsjdhljqlzbpmsmmsxlqqnhknblrddnxxdhddjcyygylxgzlxsygmqqgkhbpmxyxlytqwlwgcpbmqxc"
-"yzydrjbhtdjyhqshtmjsbyplwhlzffnypmhxxhpltbqpfbjwqdbygpnztpfzjgsddtqshzeawzzylltyybwjkxxghlfkxdjtmszs"
-"qynzggswqsphtlsskmclzxyszqzxncjdqgzdlfnykljcjllzlmzznhydsshthzzlzzbbhqzwwycrzhlyqqjbeyfxxxwhsrxwqhwp"
-"slmsskzttygyqqwrslalhmjtqjsmxqbjjzjxzyzkxbyqxbjxshztsfjlxmxzxfghkzszggylclsarjyhslllmzxelglxydjytlfb"
-"hbpnlyzfbbhptgjkwetzhkjjxzxxglljlstgshjjyqlqzfkcgnndjsszfdbctwwseqfhqjbsaqtgypqlbxbmmywxgslzhglzgqyf"
-"lzbyfzjfrysfmbyzhqgfwzsyfyjjphzbyyzffwodgrlmftwlbzgycqxcdjygzyyyytytydwegazyhxjlzyyhlrmgrxxzclhneljj"
-"tjtpwjybjjbxjjtjteekhwsljplpsfyzpqqbdlqjjtyyqlyzkdksqjyyqzldqtgjqyzjsucmryqthtejmfctyhypkmhyzwjdqfhy"
-"yxwshctxrljhqxhccyyyjltkttytmxgtcjtzayyoczlylbszywjytsjyhbyshfjlygjxxtmzyyltxxypzlxyjzyzyypnhmymdyyl"
-"blhlsyyqqllnjjymsoyqbzgdlyxylcqyxtszegxhzglhwbljheyxtwqmakbpqcgyshhegqcmwyywljyjhyyzlljjylhzyhmgsljl"
-"jxcjjyclycjpcpzjzjmmylcqlnqljqjsxyjmlszljqlycmmhcfmmfpqqmfylqmcffqmmmmhmznfhhjgtthhkhslnchhyqdxtmmqd"
-"cyzyxyqmyqyltdcyyyzazzcymzydlzfffmmycqzwzzmabtbyztdmnzzggdftypcgqyttssffwfdtzqssystwxjhxytsxxylbyqhw"
-"wkxhzxwznnzzjzjjqjccchyyxbzxzcyztllcqxynjycyycynzzqyyyewyczdcjycchyjlbtzyycqwmpwpymlgkdldlgkqqbgychj"
-"xy";
+namespace launchy {
+
+static_assert(TRANSLITERATION_MAX_LENGTH == 4, "regenerate the transliteration tables");
+
+// Row of s_rows for each block of 256 code points, -1 when no
+// code point of the block is transliterated
+static constexpr short s_blockRows[256] = {
+    0, 1, 2, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, 6,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 90,
+};
+
+// 0 for a code point kept as it is, otherwise the offset of its
+// transliteration in s_pool shifted left by 3 and its length
+static constexpr ushort s_rows[91][256] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        137, 137, 137, 137, 137, 137, 138, 25, 145, 145, 145, 145, 57, 57, 57, 57,
+        65, 825, 209, 209, 209, 209, 209, 0, 209, 129, 129, 129, 129, 737, 1274, 1194,
+        137, 137, 137, 137, 137, 137, 138, 25, 145, 145, 145, 145, 57, 57, 57, 57,
+        65, 825, 209, 209, 209, 209, 209, 0, 209, 129, 129, 129, 129, 737, 1274, 737,
+    },
+    {
+        137, 137, 137, 137, 137, 137, 25, 25, 25, 25, 25, 25, 25, 25, 65, 65,
+        65, 65, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 377, 377, 377, 377,
+        377, 377, 377, 377, 17, 17, 17, 17, 57, 57, 57, 57, 57, 57, 57, 57,
+        57, 57, 554, 554, 305, 305, 513, 513, 0, 697, 697, 697, 697, 697, 697, 697,
+        697, 697, 697, 825, 825, 825, 825, 825, 825, 825, 858, 858, 209, 209, 209, 209,
+        209, 209, 938, 938, 1065, 1065, 1065, 1065, 1065, 1065, 9, 9, 9, 9, 9, 9,
+        9, 9, 113, 113, 113, 113, 0, 0, 129, 129, 129, 129, 129, 129, 129, 129,
+        129, 129, 129, 129, 1385, 1385, 737, 737, 737, 257, 257, 257, 257, 257, 257, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 361, 361, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        209, 209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129,
+        129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 346, 346, 346, 698, 698, 698, 890, 890, 890, 137, 137, 57,
+        57, 209, 209, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 0, 137, 137,
+        137, 137, 0, 0, 0, 0, 377, 377, 513, 513, 209, 209, 209, 209, 0, 0,
+        305, 346, 346, 346, 377, 377, 0, 0, 825, 825, 137, 137, 0, 0, 0, 0,
+    },
+    {
+        137, 137, 137, 137, 145, 145, 145, 145, 57, 57, 57, 57, 209, 209, 209, 209,
+        1065, 1065, 1065, 1065, 129, 129, 129, 129, 9, 9, 113, 113, 0, 0, 17, 17,
+        0, 0, 0, 0, 0, 0, 137, 137, 145, 145, 209, 209, 209, 209, 209, 209,
+        209, 209, 737, 737, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 137, 0, 145, 57, 57, 0, 209, 0, 737, 209,
+        57, 137, 1305, 377, 65, 145, 257, 57, 1274, 57, 513, 697, 745, 825, 545, 209,
+        225, 1065, 0, 9, 113, 737, 361, 26, 1018, 209, 57, 737, 137, 145, 57, 57,
+        737, 137, 1305, 377, 65, 145, 257, 57, 1274, 57, 513, 697, 745, 825, 545, 209,
+        225, 1065, 9, 9, 113, 737, 361, 26, 1018, 209, 57, 737, 209, 737, 209, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1274, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        145, 145, 298, 377, 1482, 346, 57, 57, 305, 698, 890, 25, 513, 57, 129, 346,
+        137, 153, 1305, 377, 65, 145, 1578, 257, 57, 57, 513, 697, 745, 825, 209, 225,
+        1065, 9, 113, 129, 361, 514, 114, 26, 10, 12, 8, 737, 8, 145, 1514, 1466,
+        137, 153, 1305, 377, 65, 145, 1578, 257, 57, 57, 513, 697, 745, 825, 209, 225,
+        1065, 9, 113, 129, 361, 514, 114, 26, 10, 12, 8, 737, 8, 145, 1514, 1466,
+        145, 145, 298, 377, 1482, 346, 57, 57, 305, 698, 890, 25, 513, 57, 129, 346,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        377, 377, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1578, 1578, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        137, 137, 137, 137, 0, 0, 145, 145, 0, 0, 0, 0, 1578, 1578, 257, 257,
+        0, 0, 57, 57, 57, 57, 209, 209, 0, 0, 0, 0, 145, 145, 129, 129,
+        129, 129, 129, 129, 26, 26, 0, 0, 737, 737, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        137, 137, 153, 153, 153, 153, 153, 153, 25, 25, 65, 65, 65, 65, 65, 65,
+        65, 65, 65, 65, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 361, 361,
+        377, 377, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 57, 57, 57, 57,
+        513, 513, 513, 513, 513, 513, 697, 697, 697, 697, 697, 697, 697, 697, 745, 745,
+        745, 745, 745, 745, 825, 825, 825, 825, 825, 825, 825, 825, 209, 209, 209, 209,
+        209, 209, 209, 209, 225, 225, 225, 225, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 113, 113, 113, 113, 113, 113,
+        113, 113, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 1305, 1305, 1305, 1305,
+        1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 545, 545, 545, 545, 737, 737,
+        257, 257, 257, 257, 257, 257, 17, 113, 1385, 737, 137, 9, 0, 0, 1194, 0,
+        137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+        137, 137, 137, 137, 137, 137, 137, 137, 145, 145, 145, 145, 145, 145, 145, 145,
+        145, 145, 145, 145, 145, 145, 145, 145, 57, 57, 57, 57, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+        129, 129, 737, 737, 737, 737, 737, 737, 737, 737, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+        145, 145, 145, 145, 145, 145, 0, 0, 145, 145, 145, 145, 145, 145, 0, 0,
+        57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+        57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+        209, 209, 209, 209, 209, 209, 0, 0, 209, 209, 209, 209, 209, 209, 0, 0,
+        737, 737, 737, 737, 737, 737, 737, 737, 0, 737, 0, 737, 0, 737, 0, 737,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        137, 137, 145, 145, 57, 57, 57, 57, 209, 209, 737, 737, 209, 209, 0, 0,
+        137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+        57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        137, 137, 137, 137, 137, 0, 137, 137, 137, 137, 137, 137, 137, 0, 57, 0,
+        0, 0, 57, 57, 57, 0, 57, 57, 145, 145, 57, 57, 57, 0, 0, 0,
+        57, 57, 57, 57, 0, 0, 57, 57, 57, 57, 57, 57, 0, 0, 0, 0,
+        737, 737, 737, 737, 1065, 1065, 737, 737, 737, 737, 737, 737, 1065, 0, 0, 0,
+        0, 0, 209, 209, 209, 0, 209, 209, 209, 209, 209, 209, 209, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 137, 137, 57, 57, 129, 129, 145, 145, 209, 209, 602, 378, 634, 410, 682,
+        458, 618, 394, 650, 442, 1146, 1530, 91, 570, 122, 1610, 1162, 1562, 1178, 1594, 1242,
+        266, 43, 570, 8, 115, 1610, 1258, 282, 1290, 314, 826, 874, 922, 842, 906, 474,
+        154, 954, 50, 186, 986, 362, 234, 1034, 490, 170, 970, 522, 202, 1002, 746, 778,
+        810, 762, 794, 1466, 1466, 1514, 1514, 1498, 1498, 1066, 1098, 1130, 1082, 1114, 1386, 1386,
+        1418, 1402, 1434, 825, 1370, 602, 618, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 137, 137, 57, 57, 129, 129, 145, 145, 209, 209, 602, 378, 634, 410, 682,
+        458, 618, 394, 650, 442, 1146, 1530, 91, 570, 122, 1610, 1162, 1562, 1178, 1594, 1242,
+        266, 43, 570, 8, 115, 1610, 1258, 282, 1290, 314, 826, 874, 922, 842, 906, 474,
+        154, 954, 50, 186, 986, 362, 234, 1034, 490, 170, 970, 522, 202, 1002, 746, 778,
+        810, 762, 794, 1466, 1466, 1514, 1514, 1498, 1498, 1066, 1098, 1130, 1082, 1114, 1386, 1386,
+        1418, 1402, 1434, 825, 1370, 602, 618, 1306, 1338, 1322, 1354, 0, 8, 0, 0, 0,
+    },
+    {
+        737, 65, 737, 673, 9, 545, 745, 1385, 257, 9, 9, 545, 305, 153, 737, 745,
+        377, 25, 25, 257, 673, 225, 9, 9, 673, 153, 737, 25, 65, 9, 25, 65,
+        673, 697, 65, 737, 697, 737, 153, 9, 9, 305, 377, 737, 257, 257, 305, 305,
+        361, 513, 25, 25, 697, 257, 65, 17, 1385, 65, 1385, 257, 305, 697, 305, 225,
+        361, 737, 737, 825, 1385, 305, 305, 113, 745, 737, 17, 257, 1385, 257, 17, 361,
+        730, 257, 225, 225, 673, 17, 377, 9, 25, 737, 737, 737, 825, 305, 673, 737,
+        545, 545, 377, 305, 17, 17, 9, 65, 9, 305, 825, 513, 513, 113, 745, 209,
+        745, 697, 25, 1065, 545, 737, 225, 9, 825, 673, 9, 145, 25, 25, 673, 257,
+        377, 377, 697, 697, 737, 305, 697, 745, 737, 257, 257, 9, 145, 25, 737, 513,
+        737, 737, 17, 673, 1385, 305, 9, 9, 377, 377, 737, 545, 737, 257, 737, 305,
+        1385, 1385, 513, 65, 305, 17, 737, 25, 17, 745, 737, 545, 305, 113, 697, 545,
+        305, 737, 673, 153, 737, 545, 257, 697, 65, 1385, 1065, 65, 305, 1065, 1385, 737,
+        9, 1065, 697, 65, 257, 305, 225, 25, 153, 257, 305, 305, 153, 1065, 25, 361,
+        113, 697, 145, 25, 257, 9, 113, 257, 361, 545, 545, 257, 17, 113, 1065, 673,
+        17, 737, 153, 65, 697, 737, 25, 257, 9, 9, 737, 745, 745, 1065, 361, 745,
+        737, 673, 257, 225, 1385, 1385, 305, 305, 737, 361, 25, 1065, 1385, 361, 65, 361,
+    },
+    {
+        257, 673, 225, 737, 65, 65, 1385, 737, 545, 513, 737, 305, 137, 1385, 305, 361,
+        361, 545, 737, 225, 9, 361, 113, 257, 737, 17, 506, 737, 257, 737, 9, 1385,
+        250, 305, 737, 545, 9, 25, 697, 25, 545, 545, 1385, 257, 257, 545, 825, 153,
+        377, 825, 825, 545, 153, 545, 697, 257, 9, 257, 9, 153, 9, 377, 225, 737,
+        9, 737, 257, 65, 17, 745, 65, 257, 153, 673, 153, 257, 25, 1385, 65, 257,
+        257, 737, 737, 113, 257, 17, 153, 113, 9, 737, 737, 153, 257, 377, 825, 113,
+        825, 545, 673, 737, 1385, 673, 9, 513, 153, 225, 17, 17, 697, 545, 377, 737,
+        153, 361, 745, 305, 145, 153, 305, 17, 17, 377, 673, 113, 305, 25, 737, 9,
+        545, 9, 113, 513, 257, 17, 697, 737, 25, 513, 377, 697, 737, 9, 745, 257,
+        545, 737, 137, 697, 745, 145, 697, 65, 25, 25, 545, 377, 257, 737, 1065, 305,
+        545, 9, 65, 697, 113, 737, 257, 25, 673, 513, 25, 825, 825, 305, 1385, 17,
+        305, 113, 257, 257, 25, 673, 697, 305, 9, 113, 9, 113, 153, 825, 545, 218,
+        113, 737, 545, 25, 145, 673, 545, 377, 513, 1385, 305, 737, 361, 697, 257, 673,
+        697, 737, 17, 737, 545, 9, 225, 9, 361, 545, 697, 745, 225, 153, 737, 9,
+        545, 545, 545, 737, 65, 305, 25, 257, 737, 697, 697, 697, 9, 305, 545, 361,
+        17, 305, 545, 225, 305, 153, 113, 361, 361, 737, 137, 153, 737, 545, 153, 17,
+    },
+    {
+        257, 257, 153, 305, 737, 257, 697, 1385, 697, 25, 257, 377, 377, 153, 113, 9,
+        9, 745, 65, 113, 305, 257, 545, 225, 113, 17, 737, 673, 113, 377, 697, 305,
+        9, 25, 673, 361, 257, 513, 305, 257, 305, 673, 825, 697, 257, 1385, 697, 9,
+        697, 17, 65, 257, 153, 1385, 305, 825, 25, 305, 257, 737, 257, 9, 673, 673,
+        737, 25, 673, 737, 1065, 257, 25, 305, 305, 1385, 737, 153, 1065, 113, 1385, 225,
+        737, 361, 113, 1385, 145, 545, 25, 9, 513, 65, 257, 25, 113, 153, 257, 17,
+        737, 257, 257, 737, 737, 305, 545, 257, 25, 361, 361, 257, 257, 745, 305, 737,
+        545, 545, 9, 65, 257, 257, 209, 113, 113, 153, 257, 697, 673, 1385, 361, 25,
+        513, 9, 257, 9, 545, 361, 737, 1065, 697, 825, 737, 305, 745, 153, 65, 113,
+        17, 305, 545, 9, 673, 673, 25, 25, 9, 153, 545, 737, 737, 113, 9, 737,
+        361, 153, 545, 65, 257, 113, 377, 153, 25, 825, 9, 697, 25, 737, 257, 257,
+        225, 9, 137, 257, 737, 257, 257, 9, 25, 305, 25, 9, 17, 257, 673, 737,
+        65, 545, 697, 153, 225, 305, 697, 697, 745, 673, 545, 113, 737, 65, 257, 545,
+        9, 673, 305, 113, 257, 225, 545, 697, 25, 377, 697, 673, 113, 257, 1385, 305,
+        153, 17, 25, 113, 9, 737, 305, 9, 361, 545, 737, 145, 305, 305, 113, 697,
+        153, 377, 545, 9, 545, 305, 745, 737, 305, 673, 673, 225, 361, 257, 137, 9,
+    },
+    {
+        737, 305, 825, 113, 737, 65, 305, 545, 513, 305, 25, 65, 305, 9, 257, 25,
+        153, 137, 1065, 113, 65, 25, 697, 737, 305, 673, 745, 1385, 825, 673, 825, 25,
+        697, 697, 697, 513, 153, 737, 153, 257, 257, 9, 737, 17, 673, 673, 697, 113,
+        1385, 697, 25, 25, 545, 113, 545, 697, 697, 257, 825, 113, 737, 697, 825, 145,
+        1385, 737, 257, 737, 545, 25, 257, 545, 545, 377, 1065, 513, 1065, 745, 113, 25,
+        825, 65, 825, 305, 113, 9, 737, 737, 9, 9, 65, 673, 65, 377, 17, 9,
+        65, 153, 305, 377, 17, 1065, 1385, 1065, 673, 697, 737, 153, 377, 697, 545, 17,
+        697, 377, 113, 377, 545, 153, 673, 305, 65, 257, 225, 737, 305, 9, 305, 737,
+        305, 25, 113, 745, 1065, 825, 737, 745, 377, 1065, 257, 305, 25, 257, 377, 305,
+        745, 257, 745, 377, 545, 745, 225, 1065, 737, 545, 513, 305, 825, 737, 745, 9,
+        377, 745, 257, 305, 737, 745, 513, 745, 361, 545, 745, 697, 65, 113, 377, 361,
+        153, 17, 25, 305, 17, 513, 737, 697, 225, 361, 745, 65, 545, 697, 673, 305,
+        305, 9, 745, 113, 673, 377, 257, 9, 305, 697, 673, 65, 697, 65, 377, 305,
+        737, 25, 137, 697, 25, 745, 257, 25, 9, 65, 305, 697, 697, 825, 545, 65,
+        305, 361, 361, 361, 361, 305, 25, 257, 361, 745, 257, 361, 361, 225, 361, 513,
+        17, 513, 377, 65, 225, 9, 545, 513, 113, 137, 25, 305, 65, 17, 17, 257,
+    },
+    {
+        65, 65, 25, 1065, 1065, 25, 361, 673, 737, 305, 513, 673, 25, 25, 1385, 305,
+        65, 545, 17, 1385, 305, 697, 737, 697, 697, 257, 377, 25, 361, 25, 673, 65,
+        9, 745, 697, 257, 225, 153, 305, 305, 225, 697, 9, 153, 25, 305, 377, 377,
+        65, 25, 513, 513, 65, 145, 257, 9, 673, 25, 25, 513, 305, 377, 25, 377,
+        513, 65, 305, 113, 305, 65, 697, 257, 737, 25, 545, 513, 697, 673, 9, 25,
+        377, 305, 25, 697, 113, 361, 225, 25, 673, 25, 257, 377, 1385, 225, 305, 65,
+        673, 737, 257, 305, 305, 153, 737, 305, 17, 9, 305, 65, 257, 1385, 377, 361,
+        9, 305, 377, 257, 513, 673, 25, 25, 257, 697, 697, 225, 9, 225, 513, 305,
+        377, 673, 305, 17, 257, 257, 697, 305, 225, 697, 377, 305, 377, 305, 305, 113,
+        17, 305, 305, 737, 305, 257, 25, 257, 745, 697, 257, 697, 737, 673, 153, 377,
+        305, 1385, 745, 697, 305, 513, 545, 257, 65, 257, 825, 305, 673, 9, 737, 257,
+        745, 697, 305, 697, 697, 305, 513, 737, 1385, 545, 745, 513, 305, 697, 17, 9,
+        513, 305, 377, 153, 745, 25, 697, 737, 737, 745, 513, 545, 305, 673, 697, 153,
+        745, 697, 697, 513, 745, 65, 545, 545, 513, 1385, 737, 545, 737, 9, 697, 745,
+        697, 225, 9, 305, 673, 673, 305, 673, 545, 737, 545, 361, 305, 113, 305, 65,
+        545, 745, 545, 545, 697, 697, 25, 545, 673, 153, 9, 737, 305, 153, 377, 1385,
+    },
+    {
+        737, 745, 153, 377, 377, 153, 25, 737, 545, 225, 305, 737, 377, 225, 145, 225,
+        361, 377, 65, 305, 377, 153, 17, 153, 825, 9, 673, 305, 737, 257, 305, 513,
+        305, 513, 17, 545, 673, 361, 377, 673, 257, 513, 361, 17, 737, 377, 513, 17,
+        65, 513, 697, 697, 9, 65, 305, 673, 545, 225, 1050, 737, 513, 737, 153, 825,
+        673, 9, 545, 673, 825, 9, 257, 9, 1385, 17, 153, 9, 545, 1385, 17, 545,
+        1385, 153, 257, 257, 545, 67, 745, 825, 9, 305, 153, 9, 153, 513, 153, 153,
+        257, 666, 697, 737, 697, 545, 377, 1385, 545, 65, 1065, 1385, 737, 673, 257, 745,
+        737, 1385, 9, 305, 673, 697, 25, 305, 545, 545, 305, 545, 513, 305, 145, 673,
+        545, 9, 25, 737, 145, 113, 697, 257, 17, 697, 737, 737, 737, 9, 65, 257,
+        225, 137, 673, 737, 257, 25, 745, 113, 697, 9, 17, 113, 257, 25, 361, 737,
+        257, 737, 545, 737, 697, 305, 9, 65, 25, 305, 673, 137, 377, 737, 9, 697,
+        25, 673, 697, 737, 737, 737, 9, 17, 745, 1065, 673, 673, 513, 697, 65, 545,
+        257, 9, 82, 9, 9, 9, 737, 65, 737, 25, 305, 737, 9, 361, 9, 305,
+        153, 361, 1065, 9, 9, 257, 673, 9, 153, 545, 545, 225, 545, 305, 737, 9,
+        65, 1065, 25, 513, 377, 305, 697, 377, 65, 513, 257, 305, 257, 153, 65, 513,
+        113, 25, 9, 737, 673, 225, 737, 17, 9, 113, 25, 697, 65, 305, 65, 17,
+    },
+    {
+        745, 545, 745, 25, 377, 545, 737, 257, 17, 305, 65, 65, 113, 745, 17, 697,
+        113, 545, 257, 545, 737, 697, 737, 745, 209, 17, 737, 305, 25, 697, 113, 737,
+        361, 153, 673, 673, 545, 225, 361, 153, 65, 361, 17, 17, 113, 513, 9, 673,
+        17, 257, 737, 737, 1385, 25, 825, 545, 545, 25, 1065, 1385, 17, 209, 1385, 377,
+        737, 305, 697, 145, 377, 1385, 65, 673, 25, 1385, 377, 361, 305, 737, 25, 9,
+        825, 113, 745, 737, 113, 209, 697, 153, 737, 377, 1385, 673, 1385, 145, 9, 305,
+        225, 1385, 825, 745, 697, 1065, 737, 65, 257, 9, 257, 113, 545, 737, 673, 225,
+        257, 377, 25, 1385, 545, 17, 825, 377, 225, 737, 545, 9, 17, 745, 737, 673,
+        305, 545, 257, 113, 65, 225, 225, 153, 361, 737, 17, 257, 17, 113, 305, 737,
+        361, 65, 257, 1385, 513, 377, 513, 257, 153, 697, 65, 825, 113, 9, 545, 17,
+        673, 145, 145, 377, 257, 257, 737, 697, 257, 745, 745, 257, 737, 305, 257, 377,
+        545, 257, 545, 513, 17, 513, 9, 113, 545, 825, 545, 545, 1385, 737, 697, 737,
+        137, 225, 9, 113, 17, 545, 65, 1385, 17, 257, 737, 745, 225, 545, 137, 377,
+        513, 737, 65, 545, 153, 17, 825, 17, 545, 513, 65, 225, 305, 825, 745, 737,
+        17, 737, 697, 225, 745, 377, 209, 25, 9, 697, 825, 257, 17, 513, 545, 545,
+        697, 225, 257, 257, 697, 153, 745, 697, 9, 361, 153, 17, 17, 377, 737, 377,
+    },
+    {
+        737, 737, 377, 377, 153, 17, 9, 25, 737, 137, 673, 113, 737, 1385, 697, 545,
+        113, 257, 673, 25, 145, 257, 737, 65, 673, 65, 673, 745, 745, 17, 113, 513,
+        697, 697, 9, 257, 17, 697, 9, 305, 257, 1385, 361, 737, 17, 673, 9, 1385,
+        9, 25, 1385, 697, 673, 137, 257, 737, 825, 737, 113, 697, 9, 545, 113, 17,
+        137, 257, 825, 513, 257, 257, 9, 257, 257, 697, 137, 545, 545, 257, 1385, 1385,
+        25, 113, 377, 673, 673, 113, 65, 65, 737, 257, 113, 25, 25, 17, 737, 673,
+        257, 361, 697, 545, 225, 9, 697, 257, 737, 377, 225, 257, 9, 257, 825, 377,
+        697, 825, 65, 673, 113, 153, 65, 697, 545, 377, 113, 25, 113, 137, 305, 65,
+        513, 737, 1385, 825, 9, 737, 257, 697, 305, 17, 17, 257, 257, 25, 1385, 825,
+        737, 737, 257, 737, 1385, 745, 17, 737, 25, 17, 17, 737, 545, 17, 305, 513,
+        257, 1385, 9, 545, 17, 257, 737, 545, 697, 737, 9, 513, 673, 737, 9, 225,
+        9, 697, 737, 257, 1385, 745, 737, 225, 225, 513, 153, 737, 377, 697, 513, 257,
+        17, 113, 737, 545, 137, 545, 673, 9, 737, 9, 17, 545, 137, 9, 745, 25,
+        17, 513, 65, 9, 25, 1065, 9, 1385, 305, 225, 1385, 545, 9, 377, 257, 305,
+        697, 1385, 1385, 9, 25, 17, 9, 305, 17, 9, 673, 825, 17, 25, 9, 145,
+        377, 825, 65, 137, 673, 113, 153, 137, 137, 697, 257, 257, 745, 9, 9, 113,
+    },
+    {
+        65, 673, 305, 25, 305, 513, 113, 9, 25, 305, 137, 545, 225, 697, 377, 377,
+        545, 17, 17, 377, 545, 545, 257, 25, 545, 225, 65, 745, 745, 17, 697, 65,
+        377, 113, 737, 153, 737, 9, 305, 745, 545, 17, 745, 1065, 25, 225, 545, 545,
+        305, 257, 25, 513, 257, 545, 9, 17, 745, 697, 673, 545, 545, 113, 113, 17,
+        545, 1385, 257, 361, 513, 17, 25, 25, 257, 65, 737, 113, 25, 305, 737, 545,
+        673, 17, 697, 545, 65, 17, 737, 225, 305, 673, 545, 737, 697, 9, 737, 737,
+        65, 257, 209, 257, 305, 825, 737, 545, 673, 145, 257, 737, 9, 673, 737, 137,
+        737, 545, 1385, 737, 225, 65, 377, 545, 65, 65, 545, 9, 225, 225, 737, 257,
+        825, 65, 697, 113, 1385, 1065, 17, 545, 737, 65, 545, 257, 257, 305, 17, 113,
+        25, 545, 745, 25, 257, 697, 17, 225, 737, 737, 737, 737, 745, 17, 257, 697,
+        697, 17, 825, 545, 745, 737, 697, 697, 697, 745, 65, 25, 225, 225, 545, 17,
+        745, 545, 65, 513, 737, 25, 737, 1065, 65, 697, 113, 545, 305, 25, 17, 17,
+        257, 257, 545, 257, 697, 25, 25, 697, 737, 697, 825, 257, 9, 17, 257, 305,
+        257, 257, 697, 825, 825, 1065, 697, 1385, 17, 737, 673, 9, 825, 305, 17, 545,
+        737, 825, 113, 113, 113, 513, 737, 305, 225, 737, 25, 17, 17, 737, 145, 377,
+        513, 25, 113, 113, 1385, 697, 377, 673, 1065, 697, 377, 377, 113, 377, 113, 737,
+    },
+    {
+        377, 737, 17, 225, 737, 17, 737, 697, 673, 737, 673, 377, 25, 1385, 737, 673,
+        513, 225, 737, 737, 737, 113, 113, 113, 113, 697, 17, 737, 17, 697, 697, 113,
+        737, 113, 113, 9, 225, 697, 513, 737, 257, 545, 377, 257, 1385, 377, 225, 737,
+        65, 9, 9, 257, 257, 65, 673, 545, 9, 513, 25, 673, 825, 745, 305, 305,
+        257, 257, 153, 545, 737, 673, 745, 305, 1065, 113, 361, 361, 153, 113, 513, 17,
+        257, 513, 153, 545, 697, 305, 305, 513, 65, 545, 305, 113, 697, 153, 1385, 361,
+        257, 225, 225, 113, 513, 673, 113, 257, 113, 377, 225, 65, 377, 825, 113, 225,
+        305, 737, 361, 137, 697, 673, 745, 513, 377, 545, 153, 65, 25, 697, 257, 361,
+        17, 257, 25, 697, 697, 697, 697, 137, 65, 225, 745, 545, 65, 305, 17, 697,
+        25, 25, 697, 377, 737, 17, 65, 257, 361, 377, 737, 65, 65, 377, 25, 737,
+        737, 361, 377, 737, 65, 545, 513, 9, 9, 145, 153, 65, 17, 737, 513, 65,
+        513, 65, 513, 17, 825, 137, 545, 545, 737, 153, 225, 153, 737, 737, 17, 545,
+        257, 673, 377, 137, 361, 361, 673, 737, 305, 545, 65, 745, 697, 305, 25, 9,
+        673, 257, 697, 697, 225, 25, 17, 153, 9, 545, 377, 305, 737, 825, 65, 737,
+        153, 737, 673, 9, 225, 257, 1385, 305, 697, 257, 513, 9, 65, 65, 113, 137,
+        25, 113, 153, 545, 257, 65, 737, 257, 737, 225, 305, 257, 673, 9, 305, 825,
+    },
+    {
+        513, 513, 113, 513, 825, 305, 65, 305, 377, 737, 737, 225, 377, 113, 697, 361,
+        737, 673, 513, 137, 9, 65, 825, 113, 25, 737, 17, 153, 697, 1385, 65, 257,
+        17, 153, 153, 737, 65, 1385, 305, 1065, 737, 377, 513, 257, 737, 17, 145, 737,
+        737, 361, 305, 745, 9, 65, 113, 737, 361, 257, 305, 305, 17, 377, 25, 545,
+        225, 697, 545, 17, 697, 65, 1385, 545, 545, 305, 513, 737, 113, 25, 737, 513,
+        9, 9, 9, 745, 113, 1385, 25, 113, 113, 673, 257, 697, 225, 153, 9, 257,
+        65, 257, 1385, 257, 545, 377, 257, 137, 377, 737, 513, 113, 737, 1385, 545, 697,
+        17, 697, 9, 225, 153, 25, 697, 697, 209, 673, 745, 745, 257, 9, 9, 697,
+        25, 745, 153, 305, 25, 9, 257, 257, 513, 737, 65, 25, 257, 305, 377, 673,
+        673, 65, 9, 745, 25, 737, 113, 257, 673, 673, 697, 1385, 257, 673, 257, 545,
+        9, 9, 361, 225, 113, 113, 361, 673, 745, 65, 65, 257, 65, 9, 17, 65,
+        113, 65, 1385, 361, 17, 113, 65, 737, 257, 305, 737, 673, 305, 673, 513, 737,
+        225, 153, 65, 305, 737, 737, 545, 113, 697, 305, 17, 65, 1065, 673, 545, 545,
+        545, 17, 137, 737, 65, 17, 1065, 305, 697, 513, 697, 737, 113, 1385, 17, 697,
+        697, 1065, 697, 697, 1065, 25, 545, 737, 697, 153, 1385, 9, 1065, 9, 257, 257,
+        9, 737, 745, 513, 257, 257, 17, 17, 513, 737, 17, 545, 513, 9, 745, 65,
+    },
+    {
+        9, 737, 65, 737, 25, 305, 225, 153, 257, 153, 9, 673, 697, 361, 25, 545,
+        545, 545, 825, 545, 513, 545, 1385, 737, 1385, 9, 65, 257, 737, 673, 209, 377,
+        377, 673, 745, 745, 737, 17, 25, 65, 257, 113, 113, 361, 305, 737, 737, 153,
+        377, 9, 113, 113, 113, 737, 153, 737, 513, 305, 65, 17, 513, 737, 545, 153,
+        145, 697, 17, 113, 737, 225, 305, 673, 825, 361, 545, 361, 65, 737, 513, 257,
+        17, 673, 513, 257, 153, 737, 305, 113, 257, 153, 545, 17, 361, 65, 545, 513,
+        65, 137, 9, 1385, 113, 137, 1385, 137, 305, 697, 65, 737, 305, 9, 361, 17,
+        153, 697, 65, 825, 825, 113, 825, 673, 305, 113, 305, 825, 25, 17, 545, 361,
+        305, 9, 1065, 361, 1385, 17, 257, 361, 745, 65, 1065, 737, 305, 737, 305, 1385,
+        257, 225, 65, 305, 513, 257, 737, 305, 737, 745, 225, 25, 737, 257, 825, 737,
+        825, 545, 361, 153, 737, 113, 361, 737, 361, 1385, 737, 377, 65, 153, 825, 257,
+        257, 257, 65, 825, 737, 113, 545, 257, 145, 745, 745, 673, 153, 9, 673, 145,
+        17, 545, 361, 257, 745, 153, 745, 361, 697, 257, 257, 9, 1065, 545, 737, 745,
+        305, 377, 9, 545, 1385, 257, 305, 9, 225, 1065, 737, 65, 305, 9, 305, 377,
+        545, 17, 305, 305, 377, 697, 305, 305, 737, 825, 257, 257, 305, 545, 17, 377,
+        545, 513, 737, 745, 697, 225, 737, 737, 737, 25, 545, 737, 113, 1385, 673, 257,
+    },
+    {
+        9, 1385, 17, 1385, 697, 737, 1065, 305, 697, 225, 545, 9, 697, 9, 545, 745,
+        361, 9, 1385, 1385, 513, 697, 25, 113, 825, 545, 825, 737, 825, 225, 9, 305,
+        9, 257, 17, 65, 257, 145, 225, 113, 545, 745, 737, 737, 1385, 545, 737, 737,
+        9, 737, 1385, 697, 545, 305, 673, 257, 673, 545, 257, 65, 25, 697, 145, 145,
+        145, 697, 745, 25, 225, 305, 225, 25, 697, 1385, 153, 545, 9, 673, 17, 361,
+        1385, 1385, 113, 361, 361, 305, 113, 825, 673, 305, 17, 305, 673, 65, 545, 17,
+        1385, 697, 153, 737, 257, 825, 361, 305, 697, 137, 697, 513, 737, 737, 305, 697,
+        65, 545, 17, 17, 737, 25, 9, 113, 737, 737, 1385, 825, 1065, 305, 737, 545,
+        737, 1385, 113, 1065, 745, 65, 1065, 673, 17, 1385, 673, 25, 745, 361, 305, 65,
+        737, 257, 745, 17, 745, 737, 737, 545, 305, 1385, 745, 737, 257, 673, 257, 545,
+        113, 697, 745, 1065, 9, 225, 1385, 1385, 25, 17, 137, 673, 153, 545, 737, 377,
+        257, 737, 225, 545, 737, 737, 1065, 1065, 25, 697, 745, 225, 737, 745, 377, 513,
+        9, 305, 9, 257, 737, 9, 1065, 745, 737, 305, 9, 825, 545, 113, 225, 697,
+        825, 153, 137, 225, 225, 737, 225, 737, 697, 545, 737, 737, 257, 513, 737, 825,
+        697, 65, 257, 737, 305, 257, 25, 257, 825, 825, 697, 745, 257, 17, 17, 137,
+        1065, 673, 745, 225, 377, 1385, 673, 113, 257, 745, 545, 545, 745, 697, 697, 17,
+    },
+    {
+        377, 65, 257, 545, 737, 17, 545, 513, 737, 545, 737, 25, 305, 745, 361, 361,
+        737, 737, 17, 305, 361, 9, 153, 9, 9, 673, 697, 545, 545, 825, 65, 737,
+        25, 137, 825, 825, 745, 113, 25, 305, 25, 737, 225, 1065, 1065, 825, 737, 113,
+        737, 673, 825, 737, 737, 745, 153, 745, 9, 545, 825, 65, 697, 737, 697, 737,
+        9, 697, 305, 1065, 697, 545, 737, 9, 545, 673, 745, 697, 697, 737, 257, 697,
+        257, 305, 305, 305, 513, 737, 257, 257, 25, 9, 361, 153, 257, 545, 545, 745,
+        9, 113, 153, 305, 377, 825, 545, 737, 257, 17, 697, 545, 825, 745, 25, 1385,
+        9, 25, 737, 257, 737, 361, 257, 697, 545, 153, 1065, 825, 825, 825, 737, 697,
+        153, 825, 1065, 113, 377, 257, 673, 737, 9, 137, 113, 9, 1385, 1065, 737, 17,
+        737, 305, 257, 745, 257, 65, 17, 257, 377, 257, 65, 1385, 737, 153, 9, 9,
+        25, 9, 513, 545, 9, 737, 17, 737, 113, 545, 545, 377, 25, 673, 377, 545,
+        257, 257, 9, 17, 737, 545, 305, 9, 25, 1065, 17, 745, 513, 513, 153, 545,
+        25, 257, 305, 737, 305, 737, 745, 513, 673, 17, 257, 305, 361, 825, 153, 17,
+        745, 673, 17, 737, 9, 825, 305, 825, 257, 737, 153, 513, 825, 673, 745, 25,
+        697, 377, 673, 17, 1385, 697, 257, 825, 257, 9, 1385, 545, 513, 17, 697, 305,
+        17, 737, 737, 153, 673, 697, 153, 361, 25, 65, 9, 545, 65, 697, 65, 9,
+    },
+    {
+        225, 361, 257, 225, 9, 513, 305, 737, 257, 1385, 257, 545, 257, 65, 65, 545,
+        305, 9, 745, 745, 145, 377, 305, 9, 25, 9, 9, 745, 377, 25, 697, 545,
+        545, 513, 737, 737, 737, 697, 825, 737, 225, 1385, 1385, 1385, 377, 737, 65, 513,
+        257, 305, 377, 377, 377, 257, 377, 377, 9, 737, 25, 513, 825, 305, 1385, 825,
+        305, 225, 25, 545, 153, 305, 305, 113, 673, 113, 305, 1385, 65, 9, 9, 225,
+        305, 545, 257, 545, 825, 257, 545, 129, 745, 145, 697, 225, 545, 361, 1226, 545,
+        113, 697, 697, 545, 25, 697, 305, 545, 305, 305, 697, 305, 257, 545, 25, 113,
+        225, 9, 1385, 545, 697, 737, 65, 17, 697, 737, 673, 1065, 1385, 17, 9, 737,
+        25, 9, 673, 737, 737, 153, 737, 137, 737, 1385, 305, 305, 305, 673, 361, 1385,
+        673, 25, 673, 673, 25, 305, 673, 377, 545, 137, 697, 65, 153, 257, 257, 737,
+        305, 377, 513, 377, 545, 225, 697, 113, 257, 737, 361, 545, 305, 697, 113, 225,
+        137, 65, 513, 737, 673, 17, 225, 745, 137, 113, 697, 25, 225, 65, 25, 513,
+        153, 745, 113, 545, 737, 153, 17, 513, 697, 145, 825, 545, 65, 697, 145, 145,
+        377, 673, 65, 737, 745, 9, 137, 1385, 17, 257, 745, 697, 305, 113, 1385, 737,
+        377, 545, 697, 737, 673, 257, 697, 305, 145, 145, 737, 737, 153, 673, 673, 361,
+        361, 825, 697, 737, 545, 1065, 65, 9, 25, 113, 377, 305, 377, 545, 737, 737,
+    },
+    {
+        825, 513, 697, 697, 737, 673, 513, 25, 25, 113, 697, 17, 305, 697, 673, 745,
+        513, 513, 257, 377, 25, 737, 737, 377, 697, 697, 697, 305, 65, 257, 377, 737,
+        65, 17, 257, 1385, 545, 225, 737, 9, 305, 153, 257, 513, 65, 257, 377, 737,
+        257, 257, 17, 737, 1385, 737, 361, 673, 737, 113, 737, 257, 9, 257, 737, 145,
+        257, 257, 697, 737, 745, 17, 305, 305, 17, 113, 9, 745, 673, 1385, 737, 257,
+        697, 513, 737, 737, 1385, 257, 25, 9, 1065, 513, 673, 737, 113, 697, 113, 65,
+        545, 1385, 25, 113, 737, 305, 513, 697, 1385, 9, 673, 257, 1385, 153, 65, 25,
+        673, 737, 825, 25, 305, 9, 1065, 9, 257, 305, 697, 513, 25, 65, 25, 65,
+        113, 697, 257, 257, 257, 137, 25, 673, 673, 257, 257, 65, 65, 545, 737, 225,
+        697, 545, 257, 153, 673, 305, 737, 697, 257, 697, 697, 697, 673, 65, 65, 257,
+        673, 305, 737, 305, 737, 305, 257, 737, 545, 825, 737, 737, 737, 825, 737, 305,
+        545, 513, 545, 65, 137, 257, 1385, 737, 1065, 65, 697, 305, 737, 737, 737, 1065,
+        305, 697, 545, 697, 697, 65, 737, 545, 305, 25, 737, 1385, 737, 1385, 825, 673,
+        25, 25, 697, 65, 65, 825, 737, 737, 737, 825, 737, 25, 513, 25, 257, 17,
+        545, 545, 25, 25, 697, 377, 257, 673, 305, 377, 513, 1385, 225, 225, 25, 673,
+        673, 305, 737, 9, 153, 257, 257, 545, 737, 305, 9, 673, 225, 545, 305, 225,
+    },
+    {
+        257, 153, 9, 153, 65, 9, 361, 825, 9, 361, 225, 257, 545, 17, 65, 1385,
+        257, 113, 65, 1385, 225, 225, 113, 361, 697, 257, 257, 153, 257, 65, 745, 737,
+        737, 225, 673, 305, 1065, 9, 65, 257, 9, 673, 257, 9, 673, 545, 153, 65,
+        377, 25, 225, 257, 9, 1385, 65, 1385, 25, 9, 673, 257, 377, 745, 65, 17,
+        257, 545, 745, 1385, 1385, 361, 737, 153, 225, 65, 377, 225, 17, 113, 745, 305,
+        113, 17, 257, 9, 745, 745, 153, 377, 257, 745, 153, 257, 305, 25, 361, 257,
+        1385, 361, 257, 153, 153, 257, 745, 673, 25, 361, 745, 153, 65, 745, 25, 305,
+        545, 697, 377, 225, 825, 305, 153, 153, 545, 377, 737, 17, 737, 737, 305, 377,
+        225, 113, 257, 377, 257, 745, 673, 153, 673, 113, 25, 377, 737, 545, 305, 545,
+        697, 1385, 257, 513, 737, 65, 225, 65, 737, 745, 377, 25, 361, 113, 225, 361,
+        545, 737, 257, 113, 257, 545, 65, 257, 545, 113, 377, 513, 745, 113, 737, 153,
+        153, 25, 697, 153, 305, 137, 9, 513, 737, 113, 9, 9, 673, 737, 737, 745,
+        9, 257, 545, 361, 305, 145, 1385, 697, 545, 697, 697, 9, 257, 153, 673, 305,
+        305, 305, 137, 513, 697, 737, 697, 545, 697, 737, 25, 25, 113, 9, 545, 745,
+        25, 1385, 361, 513, 513, 513, 153, 9, 545, 697, 697, 697, 697, 305, 737, 545,
+        113, 737, 697, 113, 305, 737, 737, 113, 65, 225, 305, 17, 825, 17, 825, 825,
+    },
+    {
+        513, 153, 737, 673, 825, 361, 673, 737, 737, 257, 153, 737, 737, 145, 9, 9,
+        145, 9, 9, 377, 65, 737, 17, 361, 17, 1385, 113, 25, 305, 153, 9, 65,
+        257, 257, 113, 361, 65, 745, 545, 17, 25, 825, 305, 257, 737, 745, 673, 1385,
+        9, 1065, 737, 305, 65, 257, 305, 673, 225, 330, 673, 153, 153, 9, 113, 305,
+        377, 377, 361, 153, 513, 305, 153, 545, 113, 377, 673, 17, 825, 377, 1385, 305,
+        545, 305, 377, 65, 697, 697, 113, 17, 257, 17, 17, 737, 737, 737, 737, 737,
+        737, 9, 545, 1385, 113, 737, 737, 737, 25, 25, 153, 65, 153, 225, 737, 225,
+        257, 737, 25, 25, 257, 737, 305, 225, 257, 737, 1385, 25, 153, 65, 697, 361,
+        1385, 257, 25, 1385, 305, 65, 545, 545, 17, 737, 17, 697, 17, 1385, 257, 257,
+        545, 305, 113, 25, 257, 697, 25, 65, 225, 545, 129, 305, 25, 257, 257, 257,
+        697, 737, 545, 305, 305, 113, 545, 225, 17, 361, 545, 1385, 225, 737, 1385, 545,
+        257, 225, 113, 65, 257, 257, 153, 65, 257, 25, 737, 17, 305, 17, 745, 697,
+        545, 153, 673, 545, 9, 153, 737, 697, 1065, 65, 113, 377, 305, 1065, 1065, 25,
+        113, 113, 113, 17, 737, 113, 25, 257, 1385, 745, 545, 361, 737, 113, 1385, 1385,
+        257, 25, 1385, 305, 1385, 545, 305, 737, 1385, 25, 9, 513, 737, 153, 257, 9,
+        25, 25, 113, 257, 673, 825, 17, 545, 825, 1385, 545, 545, 513, 17, 513, 361,
+    },
+    {
+        17, 113, 9, 1385, 209, 25, 25, 305, 737, 153, 25, 745, 225, 257, 257, 737,
+        513, 153, 825, 825, 257, 225, 153, 257, 17, 17, 257, 65, 697, 9, 737, 65,
+        65, 737, 113, 737, 361, 305, 225, 545, 737, 825, 377, 361, 545, 153, 737, 673,
+        545, 25, 153, 17, 545, 25, 225, 9, 545, 113, 737, 257, 65, 745, 513, 737,
+        9, 825, 545, 9, 545, 697, 17, 513, 745, 257, 545, 697, 737, 17, 65, 17,
+        513, 1385, 17, 545, 545, 9, 9, 513, 673, 737, 17, 17, 25, 305, 737, 545,
+        377, 697, 17, 257, 545, 25, 9, 825, 17, 145, 513, 65, 113, 377, 257, 545,
+        673, 737, 225, 513, 65, 17, 145, 545, 113, 737, 513, 25, 825, 737, 745, 737,
+        737, 737, 225, 513, 673, 737, 737, 737, 513, 545, 257, 697, 113, 17, 305, 673,
+        113, 153, 737, 673, 17, 545, 153, 745, 737, 17, 9, 673, 25, 513, 1385, 1385,
+        737, 697, 697, 17, 25, 737, 737, 697, 825, 825, 145, 673, 545, 673, 1385, 745,
+        25, 361, 153, 65, 25, 25, 745, 697, 305, 377, 377, 545, 65, 673, 513, 113,
+        697, 545, 513, 377, 825, 673, 25, 65, 377, 257, 305, 1385, 737, 305, 305, 697,
+        737, 17, 17, 673, 113, 113, 113, 825, 1385, 25, 17, 745, 545, 25, 545, 1385,
+        17, 1385, 9, 257, 305, 737, 65, 305, 25, 25, 65, 153, 673, 25, 65, 377,
+        65, 825, 737, 545, 257, 113, 17, 25, 673, 1065, 545, 25, 153, 17, 257, 113,
+    },
+    {
+        673, 25, 153, 545, 1385, 377, 673, 1385, 737, 737, 153, 545, 17, 745, 153, 737,
+        745, 737, 673, 113, 737, 145, 545, 745, 673, 513, 737, 137, 673, 737, 1065, 377,
+        737, 257, 9, 697, 361, 737, 513, 513, 673, 17, 737, 9, 9, 673, 737, 9,
+        17, 305, 377, 305, 25, 825, 545, 513, 257, 737, 25, 545, 9, 153, 545, 737,
+        545, 17, 737, 737, 697, 9, 113, 737, 25, 545, 673, 113, 17, 737, 9, 745,
+        377, 9, 25, 225, 745, 745, 377, 25, 25, 25, 25, 25, 745, 113, 257, 113,
+        137, 9, 745, 377, 673, 257, 305, 17, 513, 697, 209, 9, 673, 737, 697, 9,
+        1385, 113, 745, 545, 9, 737, 673, 513, 65, 257, 697, 305, 673, 673, 737, 225,
+        697, 9, 737, 25, 257, 113, 25, 673, 673, 225, 153, 153, 673, 305, 257, 25,
+        697, 225, 513, 17, 673, 257, 737, 737, 545, 545, 65, 113, 65, 65, 113, 9,
+        305, 25, 545, 361, 361, 697, 697, 25, 17, 673, 545, 745, 305, 697, 1385, 25,
+        305, 25, 545, 113, 9, 225, 737, 25, 545, 825, 65, 113, 305, 9, 17, 305,
+        1385, 545, 65, 673, 673, 305, 9, 513, 545, 737, 137, 745, 737, 697, 9, 305,
+        17, 745, 697, 137, 697, 737, 513, 545, 25, 737, 737, 65, 745, 825, 745, 65,
+        673, 745, 545, 745, 25, 257, 825, 825, 25, 737, 153, 257, 513, 513, 737, 361,
+        697, 745, 25, 17, 25, 745, 697, 17, 545, 1065, 25, 305, 305, 17, 9, 737,
+    },
+    {
+        697, 825, 745, 113, 305, 257, 377, 257, 377, 737, 1385, 305, 545, 9, 1065, 545,
+        25, 1385, 305, 377, 305, 673, 17, 673, 257, 65, 673, 305, 65, 25, 305, 305,
+        257, 513, 305, 513, 377, 65, 257, 673, 377, 305, 305, 737, 305, 737, 697, 545,
+        257, 545, 545, 25, 65, 673, 17, 17, 17, 145, 737, 113, 745, 17, 697, 361,
+        9, 153, 65, 305, 9, 737, 737, 9, 17, 361, 737, 9, 113, 25, 257, 673,
+        697, 225, 153, 65, 1065, 361, 1065, 257, 113, 257, 737, 513, 737, 1385, 17, 9,
+        257, 737, 673, 513, 1385, 65, 673, 257, 1065, 513, 745, 9, 737, 825, 153, 25,
+        1065, 545, 673, 153, 305, 737, 361, 137, 257, 225, 257, 257, 145, 65, 257, 25,
+        305, 737, 1385, 153, 25, 305, 1385, 17, 737, 305, 153, 673, 9, 257, 737, 1385,
+        1065, 737, 9, 257, 225, 113, 65, 513, 257, 225, 361, 225, 153, 825, 257, 113,
+        513, 697, 673, 737, 17, 153, 153, 257, 225, 825, 225, 225, 113, 737, 257, 257,
+        737, 153, 673, 825, 737, 65, 25, 225, 305, 745, 745, 25, 737, 25, 673, 745,
+        25, 737, 361, 257, 257, 65, 25, 745, 825, 697, 361, 225, 153, 225, 697, 825,
+        377, 673, 305, 113, 153, 113, 113, 825, 305, 257, 225, 257, 153, 153, 257, 825,
+        305, 513, 697, 305, 673, 737, 697, 825, 153, 257, 673, 17, 513, 9, 305, 257,
+        825, 377, 377, 673, 9, 257, 257, 513, 737, 545, 9, 17, 225, 257, 9, 825,
+    },
+    {
+        153, 25, 377, 257, 513, 65, 65, 257, 673, 137, 825, 257, 17, 305, 513, 65,
+        1065, 113, 697, 257, 697, 9, 1385, 305, 697, 305, 257, 697, 737, 1385, 113, 305,
+        825, 65, 305, 257, 305, 17, 545, 737, 137, 737, 825, 25, 153, 377, 113, 257,
+        25, 9, 9, 673, 745, 825, 305, 225, 305, 737, 113, 737, 9, 1385, 545, 257,
+        361, 513, 1385, 305, 673, 113, 513, 17, 113, 257, 225, 697, 153, 17, 9, 825,
+        305, 257, 9, 737, 257, 153, 1385, 257, 257, 257, 257, 697, 9, 737, 697, 9,
+        153, 305, 17, 65, 1385, 1385, 673, 225, 9, 697, 745, 745, 361, 153, 305, 65,
+        1385, 137, 673, 737, 257, 113, 25, 305, 113, 153, 825, 825, 1385, 257, 545, 673,
+        545, 25, 65, 9, 697, 673, 377, 65, 9, 65, 225, 65, 257, 17, 305, 113,
+        673, 673, 225, 9, 1385, 697, 737, 737, 305, 257, 697, 377, 737, 545, 737, 257,
+        697, 25, 113, 25, 153, 305, 113, 513, 113, 737, 25, 257, 305, 113, 673, 513,
+        153, 9, 305, 697, 377, 745, 377, 257, 65, 745, 25, 9, 377, 225, 737, 825,
+        305, 257, 737, 673, 737, 737, 513, 825, 545, 1065, 225, 1385, 9, 257, 545, 745,
+        113, 825, 25, 9, 257, 257, 737, 545, 737, 153, 737, 17, 737, 257, 137, 545,
+        737, 1385, 673, 25, 305, 113, 697, 697, 25, 513, 305, 305, 113, 305, 17, 377,
+        65, 545, 65, 545, 737, 673, 737, 257, 257, 153, 737, 1385, 65, 697, 1385, 673,
+    },
+    {
+        25, 377, 697, 257, 377, 305, 377, 673, 1065, 673, 257, 25, 257, 9, 9, 153,
+        25, 1065, 225, 25, 9, 513, 737, 65, 257, 825, 545, 305, 9, 673, 377, 545,
+        9, 9, 305, 745, 737, 65, 825, 9, 113, 257, 113, 225, 153, 65, 697, 113,
+        513, 257, 1385, 545, 673, 1385, 673, 113, 257, 145, 545, 825, 673, 25, 257, 377,
+        1385, 145, 257, 513, 9, 9, 153, 737, 153, 1065, 113, 9, 9, 9, 697, 25,
+        25, 377, 153, 225, 9, 257, 673, 9, 257, 697, 25, 25, 377, 697, 697, 697,
+        257, 545, 17, 257, 673, 113, 17, 25, 257, 745, 673, 377, 737, 257, 673, 257,
+        825, 745, 25, 209, 25, 9, 257, 305, 745, 745, 257, 9, 673, 225, 305, 737,
+        377, 673, 697, 305, 737, 305, 225, 225, 697, 65, 545, 1065, 377, 257, 737, 545,
+        25, 25, 9, 545, 17, 9, 17, 377, 113, 257, 825, 697, 257, 1385, 257, 513,
+        305, 25, 545, 113, 25, 361, 25, 305, 545, 697, 153, 745, 673, 153, 25, 257,
+        257, 1385, 225, 673, 65, 825, 17, 545, 697, 305, 25, 113, 17, 737, 257, 697,
+        377, 737, 697, 825, 697, 9, 257, 257, 225, 25, 545, 65, 9, 25, 673, 673,
+        17, 305, 673, 513, 9, 545, 257, 225, 153, 137, 305, 737, 145, 745, 9, 745,
+        305, 113, 257, 65, 545, 697, 25, 305, 737, 1065, 737, 737, 825, 1385, 305, 153,
+        825, 377, 257, 257, 113, 745, 305, 545, 697, 113, 153, 9, 697, 737, 1065, 257,
+    },
+    {
+        225, 737, 697, 9, 9, 25, 825, 545, 225, 17, 697, 697, 17, 737, 697, 697,
+        673, 673, 257, 673, 697, 545, 737, 745, 1065, 9, 737, 25, 545, 257, 697, 745,
+        745, 25, 257, 697, 113, 257, 9, 65, 1385, 113, 305, 305, 697, 697, 825, 257,
+        377, 377, 673, 545, 225, 361, 9, 513, 737, 377, 737, 377, 17, 153, 361, 257,
+        225, 65, 513, 745, 1385, 377, 17, 25, 545, 745, 9, 377, 65, 545, 305, 745,
+        25, 305, 257, 65, 737, 25, 137, 153, 545, 305, 65, 697, 825, 153, 25, 65,
+        673, 737, 377, 9, 513, 737, 65, 673, 113, 545, 65, 305, 305, 737, 545, 745,
+        9, 257, 673, 137, 257, 65, 257, 361, 9, 697, 673, 545, 737, 305, 9, 305,
+        257, 737, 697, 153, 113, 545, 545, 1385, 545, 673, 673, 257, 153, 305, 257, 129,
+        361, 153, 153, 697, 737, 697, 1385, 65, 9, 697, 305, 17, 545, 305, 737, 257,
+        305, 1385, 113, 65, 305, 25, 257, 361, 673, 257, 673, 257, 257, 65, 257, 9,
+        545, 257, 257, 673, 697, 257, 25, 65, 257, 361, 305, 17, 737, 9, 225, 737,
+        745, 225, 673, 257, 745, 697, 225, 225, 697, 361, 361, 545, 305, 305, 825, 257,
+        257, 737, 697, 9, 305, 145, 737, 673, 257, 361, 225, 361, 257, 513, 9, 737,
+        1385, 305, 305, 305, 17, 1065, 65, 305, 257, 257, 545, 113, 545, 545, 377, 697,
+        377, 17, 737, 65, 545, 25, 9, 513, 737, 9, 1385, 745, 745, 257, 25, 1385,
+    },
+    {
+        737, 153, 137, 257, 153, 305, 513, 9, 17, 361, 17, 305, 25, 545, 745, 17,
+        361, 673, 17, 737, 545, 545, 737, 257, 361, 113, 9, 305, 737, 257, 361, 545,
+        737, 545, 225, 257, 697, 25, 17, 745, 257, 745, 153, 545, 17, 257, 257, 9,
+        545, 737, 361, 737, 745, 825, 25, 1385, 65, 137, 153, 137, 257, 697, 545, 513,
+        113, 25, 9, 17, 17, 545, 513, 545, 305, 305, 257, 305, 9, 113, 17, 737,
+        377, 545, 9, 545, 737, 737, 17, 17, 17, 305, 1385, 545, 513, 257, 545, 9,
+        9, 153, 257, 257, 1385, 17, 17, 17, 25, 1385, 113, 257, 257, 257, 225, 305,
+        545, 9, 825, 545, 673, 673, 305, 377, 257, 737, 257, 737, 1385, 697, 697, 25,
+        1385, 545, 257, 361, 545, 545, 737, 545, 737, 17, 545, 745, 513, 737, 737, 9,
+        1385, 9, 673, 745, 825, 697, 825, 137, 737, 25, 737, 9, 225, 745, 305, 513,
+        17, 1385, 25, 673, 17, 737, 697, 137, 305, 305, 745, 257, 545, 17, 745, 745,
+        25, 825, 257, 17, 153, 17, 545, 25, 697, 545, 113, 305, 225, 697, 113, 545,
+        737, 305, 17, 65, 737, 737, 697, 113, 113, 545, 361, 9, 257, 17, 737, 545,
+        545, 9, 305, 153, 305, 737, 137, 737, 1065, 9, 745, 545, 737, 225, 697, 25,
+        513, 65, 129, 737, 17, 697, 545, 1065, 697, 825, 697, 697, 9, 113, 737, 257,
+        737, 737, 673, 737, 377, 737, 17, 17, 9, 25, 25, 9, 745, 257, 250, 113,
+    },
+    {
+        257, 673, 545, 513, 737, 673, 361, 225, 737, 737, 1065, 225, 361, 361, 697, 513,
+        673, 129, 825, 113, 9, 257, 697, 697, 257, 745, 1385, 1385, 113, 250, 673, 673,
+        737, 257, 1385, 113, 697, 697, 745, 697, 745, 225, 1385, 745, 153, 257, 9, 9,
+        113, 257, 1065, 153, 225, 65, 65, 113, 697, 673, 305, 305, 153, 545, 257, 25,
+        9, 1065, 257, 673, 673, 737, 377, 1385, 25, 9, 545, 361, 1385, 257, 697, 545,
+        25, 25, 1065, 9, 257, 65, 257, 745, 25, 737, 377, 377, 65, 257, 673, 9,
+        377, 113, 305, 9, 1385, 697, 305, 745, 737, 745, 745, 257, 737, 17, 361, 153,
+        305, 65, 377, 737, 545, 25, 25, 225, 9, 17, 545, 825, 257, 25, 9, 153,
+        9, 305, 737, 305, 377, 305, 745, 225, 225, 1385, 137, 361, 361, 737, 361, 825,
+        545, 17, 737, 257, 545, 257, 737, 697, 1065, 145, 745, 257, 377, 257, 25, 737,
+        257, 9, 9, 257, 65, 697, 697, 305, 25, 9, 673, 361, 825, 545, 257, 513,
+        225, 113, 545, 257, 377, 545, 305, 305, 377, 361, 745, 737, 737, 737, 9, 825,
+        153, 113, 737, 697, 153, 825, 697, 17, 225, 361, 257, 65, 25, 737, 361, 153,
+        745, 377, 673, 1065, 1065, 9, 9, 9, 257, 545, 737, 9, 377, 113, 257, 1065,
+        825, 737, 65, 257, 257, 25, 65, 377, 225, 305, 137, 361, 305, 361, 257, 513,
+        825, 257, 153, 697, 25, 257, 9, 257, 225, 9, 377, 25, 737, 25, 305, 9,
+    },
+    {
+        257, 697, 745, 697, 1065, 9, 257, 153, 257, 257, 697, 65, 697, 9, 697, 697,
+        737, 9, 545, 9, 673, 257, 673, 697, 737, 545, 257, 697, 9, 513, 513, 153,
+        1065, 1450, 153, 1065, 153, 257, 25, 737, 25, 545, 257, 257, 257, 145, 145, 737,
+        361, 377, 513, 697, 257, 697, 737, 737, 17, 377, 257, 9, 377, 257, 697, 361,
+        305, 17, 377, 113, 377, 1385, 513, 1065, 137, 137, 305, 737, 257, 513, 257, 673,
+        113, 9, 9, 17, 305, 305, 545, 65, 25, 737, 257, 129, 737, 305, 697, 257,
+        737, 1065, 257, 65, 673, 673, 17, 377, 305, 257, 545, 9, 9, 257, 153, 737,
+        513, 305, 225, 153, 361, 1065, 113, 305, 545, 697, 697, 361, 673, 1385, 305, 17,
+        737, 697, 673, 113, 737, 745, 153, 697, 225, 257, 65, 545, 113, 257, 737, 377,
+        153, 65, 17, 257, 257, 1065, 153, 377, 545, 17, 1385, 825, 305, 113, 305, 545,
+        697, 513, 9, 25, 361, 9, 745, 1385, 697, 9, 65, 673, 737, 9, 305, 113,
+        545, 513, 257, 9, 25, 361, 1385, 305, 697, 153, 545, 361, 113, 257, 697, 697,
+        305, 257, 697, 697, 673, 153, 697, 9, 673, 745, 673, 673, 25, 377, 25, 257,
+        361, 225, 153, 225, 17, 257, 25, 257, 305, 697, 225, 737, 737, 377, 377, 65,
+        113, 377, 1385, 65, 25, 361, 25, 257, 673, 737, 737, 737, 673, 737, 9, 9,
+        25, 697, 545, 257, 9, 513, 697, 257, 257, 257, 377, 361, 361, 25, 673, 825,
+    },
+    {
+        1385, 377, 697, 17, 673, 737, 257, 305, 305, 25, 257, 697, 673, 257, 257, 737,
+        305, 225, 305, 257, 257, 153, 225, 65, 25, 25, 745, 17, 305, 377, 545, 65,
+        673, 65, 377, 65, 697, 257, 673, 745, 361, 377, 225, 9, 737, 113, 9, 65,
+        737, 361, 1385, 1385, 65, 305, 257, 305, 737, 9, 545, 737, 737, 25, 257, 25,
+        737, 17, 257, 1385, 225, 153, 737, 513, 545, 1065, 737, 697, 737, 153, 17, 513,
+        305, 513, 9, 361, 545, 113, 257, 305, 745, 745, 25, 513, 17, 697, 697, 113,
+        825, 737, 737, 745, 9, 737, 545, 737, 257, 225, 737, 305, 673, 737, 25, 9,
+        737, 25, 1385, 745, 113, 305, 305, 513, 673, 737, 1065, 17, 697, 697, 673, 545,
+        225, 9, 377, 113, 697, 737, 737, 25, 697, 305, 9, 25, 225, 545, 305, 737,
+        257, 361, 825, 745, 697, 1065, 377, 305, 305, 113, 737, 257, 153, 545, 737, 257,
+        745, 9, 305, 737, 305, 17, 17, 361, 257, 673, 745, 9, 737, 545, 1065, 9,
+        257, 25, 1385, 113, 697, 1065, 113, 673, 257, 9, 9, 113, 513, 545, 377, 673,
+        513, 377, 9, 225, 113, 377, 25, 257, 825, 305, 9, 305, 25, 673, 25, 545,
+        17, 745, 545, 377, 377, 257, 113, 673, 737, 65, 305, 513, 257, 65, 697, 153,
+        257, 9, 545, 305, 697, 17, 737, 673, 377, 377, 377, 113, 17, 673, 9, 257,
+        225, 737, 17, 305, 17, 17, 377, 737, 737, 377, 513, 377, 377, 25, 1385, 305,
+    },
+    {
+        257, 257, 737, 697, 25, 257, 697, 545, 673, 9, 361, 113, 377, 257, 9, 697,
+        697, 697, 745, 697, 305, 9, 513, 25, 113, 153, 697, 697, 257, 257, 9, 257,
+        745, 745, 825, 737, 113, 225, 257, 9, 545, 673, 17, 305, 25, 305, 737, 673,
+        545, 737, 257, 545, 257, 673, 257, 25, 225, 9, 17, 513, 257, 257, 737, 9,
+        545, 25, 65, 361, 377, 745, 1385, 673, 1065, 697, 697, 673, 545, 1065, 361, 257,
+        113, 697, 737, 9, 113, 25, 113, 745, 305, 25, 545, 305, 305, 545, 17, 305,
+        825, 545, 113, 825, 1065, 257, 113, 257, 361, 673, 737, 17, 673, 377, 697, 697,
+        377, 25, 545, 9, 257, 9, 305, 65, 305, 697, 305, 25, 737, 65, 9, 305,
+        113, 697, 825, 737, 545, 17, 9, 257, 545, 25, 377, 305, 257, 737, 673, 225,
+        737, 697, 361, 17, 65, 305, 9, 153, 225, 25, 25, 257, 17, 305, 305, 305,
+        673, 257, 305, 673, 65, 737, 153, 9, 9, 697, 697, 25, 745, 737, 113, 113,
+        745, 673, 113, 153, 17, 305, 673, 825, 825, 737, 377, 513, 737, 1065, 673, 737,
+        673, 745, 257, 377, 25, 305, 513, 225, 65, 25, 377, 745, 737, 257, 17, 673,
+        697, 697, 9, 697, 697, 25, 697, 745, 17, 209, 697, 257, 377, 65, 737, 737,
+        361, 257, 9, 697, 305, 25, 673, 257, 697, 737, 697, 257, 673, 305, 145, 9,
+        17, 825, 737, 697, 697, 305, 545, 377, 305, 545, 697, 737, 9, 737, 737, 737,
+    },
+    {
+        545, 825, 153, 257, 697, 305, 9, 9, 257, 25, 673, 673, 25, 305, 737, 697,
+        697, 257, 697, 113, 305, 737, 697, 697, 257, 697, 697, 153, 825, 737, 697, 377,
+        673, 25, 17, 545, 737, 737, 545, 209, 545, 25, 545, 673, 513, 737, 305, 545,
+        545, 545, 737, 513, 697, 545, 9, 545, 545, 737, 673, 545, 25, 737, 513, 673,
+        545, 673, 25, 9, 377, 737, 545, 545, 737, 673, 545, 737, 377, 737, 113, 673,
+        209, 17, 545, 17, 545, 225, 737, 545, 545, 545, 129, 697, 25, 737, 145, 737,
+        25, 17, 257, 257, 25, 153, 1385, 673, 153, 153, 1385, 305, 673, 257, 9, 25,
+        9, 257, 9, 9, 697, 257, 737, 697, 513, 65, 145, 9, 305, 257, 1385, 745,
+        737, 745, 25, 737, 113, 9, 65, 9, 545, 545, 9, 25, 305, 225, 673, 673,
+        9, 673, 737, 697, 737, 737, 257, 737, 25, 745, 65, 305, 65, 257, 737, 1385,
+        25, 153, 113, 305, 9, 737, 65, 305, 513, 25, 737, 65, 65, 305, 697, 153,
+        65, 305, 305, 9, 209, 65, 257, 737, 9, 737, 545, 673, 673, 737, 545, 65,
+        17, 17, 377, 673, 673, 737, 673, 17, 65, 737, 545, 1385, 377, 745, 745, 745,
+        137, 305, 65, 737, 153, 153, 153, 225, 225, 153, 25, 745, 129, 129, 225, 697,
+        305, 257, 9, 745, 113, 545, 145, 1065, 545, 305, 745, 17, 673, 825, 129, 113,
+        225, 305, 65, 25, 153, 9, 9, 745, 9, 9, 9, 113, 513, 305, 113, 9,
+    },
+    {
+        9, 745, 745, 113, 1065, 25, 225, 697, 257, 9, 257, 745, 697, 673, 65, 9,
+        65, 745, 305, 745, 673, 225, 825, 673, 65, 545, 25, 361, 737, 825, 153, 361,
+        9, 65, 673, 545, 737, 545, 17, 737, 137, 737, 513, 673, 737, 65, 65, 697,
+        673, 737, 737, 737, 9, 9, 257, 153, 737, 65, 9, 697, 825, 113, 361, 673,
+        113, 257, 673, 225, 257, 745, 25, 17, 65, 17, 25, 257, 25, 1385, 361, 65,
+        545, 113, 745, 737, 673, 9, 225, 17, 673, 737, 737, 545, 9, 1065, 377, 305,
+        25, 1385, 113, 305, 113, 257, 257, 673, 745, 377, 1385, 305, 305, 113, 305, 17,
+        113, 673, 305, 153, 153, 17, 1385, 257, 225, 545, 545, 17, 737, 673, 361, 545,
+        545, 673, 737, 1385, 737, 737, 17, 737, 9, 25, 65, 737, 65, 17, 17, 673,
+        745, 825, 745, 113, 745, 1385, 25, 225, 153, 9, 257, 225, 225, 257, 257, 377,
+        697, 745, 257, 361, 209, 697, 697, 25, 361, 1385, 17, 745, 745, 9, 305, 257,
+        113, 113, 65, 17, 257, 257, 737, 361, 361, 737, 113, 257, 257, 377, 257, 737,
+        9, 513, 737, 305, 545, 673, 737, 305, 257, 673, 153, 17, 745, 153, 257, 257,
+        697, 737, 377, 17, 377, 361, 745, 9, 17, 225, 257, 361, 257, 9, 825, 25,
+        697, 225, 153, 673, 9, 825, 305, 545, 257, 9, 697, 545, 545, 361, 225, 745,
+        113, 737, 305, 737, 377, 153, 545, 697, 697, 65, 697, 545, 225, 257, 305, 737,
+    },
+    {
+        257, 305, 737, 17, 17, 257, 25, 737, 1385, 17, 305, 737, 697, 9, 305, 145,
+        545, 361, 9, 257, 257, 737, 1385, 545, 513, 257, 305, 697, 129, 737, 65, 113,
+        745, 697, 737, 745, 673, 305, 225, 1385, 545, 737, 17, 545, 9, 513, 113, 673,
+        305, 145, 257, 1065, 225, 545, 545, 257, 17, 17, 745, 17, 1385, 673, 225, 1385,
+        673, 697, 737, 305, 305, 673, 305, 305, 257, 9, 257, 25, 225, 17, 305, 697,
+        25, 17, 17, 825, 545, 305, 697, 673, 1385, 257, 305, 17, 153, 745, 257, 737,
+        545, 153, 65, 17, 17, 737, 225, 257, 697, 17, 697, 17, 697, 377, 361, 1385,
+        697, 25, 17, 737, 737, 113, 697, 17, 305, 545, 25, 305, 745, 9, 25, 225,
+        545, 9, 113, 513, 225, 825, 17, 673, 545, 9, 1065, 113, 737, 545, 545, 113,
+        145, 9, 737, 305, 25, 113, 697, 9, 9, 697, 9, 113, 65, 697, 697, 697,
+        1385, 1385, 737, 17, 65, 17, 1065, 305, 257, 9, 361, 377, 545, 113, 9, 737,
+        25, 257, 737, 825, 737, 17, 113, 65, 17, 1385, 305, 9, 697, 17, 113, 257,
+        65, 673, 65, 305, 257, 545, 545, 673, 17, 377, 737, 697, 113, 257, 225, 17,
+        25, 9, 673, 361, 25, 697, 825, 305, 113, 25, 697, 257, 225, 361, 9, 113,
+        225, 65, 737, 825, 737, 697, 377, 745, 305, 697, 697, 737, 25, 673, 17, 737,
+        9, 9, 17, 25, 17, 737, 697, 17, 673, 737, 673, 113, 745, 257, 737, 225,
+    },
+    {
+        153, 737, 1385, 1065, 361, 673, 737, 513, 673, 9, 737, 9, 697, 257, 65, 673,
+        305, 745, 225, 545, 737, 737, 9, 9, 1065, 17, 257, 305, 825, 737, 1385, 113,
+        673, 65, 361, 257, 153, 1385, 1385, 113, 1385, 1385, 1065, 545, 25, 1385, 17, 377,
+        737, 17, 545, 745, 513, 745, 737, 737, 737, 673, 745, 9, 745, 257, 17, 825,
+        377, 25, 145, 225, 745, 697, 673, 673, 745, 113, 25, 1385, 25, 113, 745, 745,
+        225, 545, 305, 225, 305, 305, 17, 361, 545, 737, 737, 257, 9, 545, 257, 17,
+        113, 737, 153, 745, 9, 113, 9, 737, 305, 113, 113, 673, 673, 673, 737, 737,
+        697, 17, 737, 825, 225, 737, 673, 257, 697, 25, 737, 257, 17, 257, 1385, 9,
+        745, 737, 697, 513, 361, 305, 545, 697, 1385, 377, 545, 737, 225, 305, 737, 113,
+        737, 9, 737, 545, 737, 745, 257, 25, 513, 113, 113, 1385, 697, 513, 9, 745,
+        257, 9, 737, 697, 745, 225, 1385, 697, 257, 1385, 545, 1385, 673, 257, 9, 9,
+        137, 673, 9, 737, 545, 737, 1065, 17, 9, 9, 825, 113, 9, 1065, 137, 225,
+        545, 25, 225, 1385, 25, 745, 377, 65, 545, 17, 545, 257, 65, 257, 737, 361,
+        305, 17, 377, 257, 113, 113, 9, 153, 305, 17, 377, 737, 257, 9, 257, 737,
+        9, 745, 737, 25, 697, 697, 697, 545, 153, 113, 737, 545, 17, 153, 153, 257,
+        305, 513, 9, 9, 65, 745, 137, 697, 545, 17, 737, 25, 361, 737, 377, 745,
+    },
+    {
+        673, 737, 225, 305, 737, 25, 673, 545, 305, 697, 697, 697, 305, 377, 9, 697,
+        257, 377, 673, 697, 737, 25, 305, 25, 25, 257, 209, 113, 737, 545, 745, 113,
+        745, 113, 113, 697, 697, 1385, 113, 377, 225, 545, 737, 745, 257, 745, 513, 697,
+        225, 9, 257, 257, 257, 545, 17, 513, 673, 737, 9, 545, 25, 113, 737, 305,
+        257, 737, 17, 545, 9, 17, 737, 545, 257, 513, 545, 697, 257, 1385, 225, 9,
+        673, 225, 737, 17, 305, 1385, 225, 305, 225, 1385, 545, 673, 673, 737, 697, 545,
+        9, 65, 17, 745, 1065, 9, 697, 257, 257, 737, 257, 1385, 113, 113, 25, 737,
+        545, 737, 9, 257, 257, 9, 17, 153, 9, 25, 25, 9, 113, 225, 697, 1385,
+        9, 9, 25, 305, 25, 17, 825, 697, 25, 377, 25, 17, 9, 9, 225, 17,
+        737, 697, 17, 361, 17, 17, 545, 305, 9, 545, 737, 697, 697, 825, 737, 697,
+        9, 257, 65, 17, 257, 545, 737, 697, 9, 545, 697, 1385, 257, 737, 513, 25,
+        697, 65, 737, 137, 545, 257, 25, 745, 65, 65, 737, 9, 225, 305, 113, 673,
+        305, 257, 697, 825, 1385, 673, 225, 9, 9, 9, 1385, 25, 113, 9, 113, 9,
+        257, 697, 153, 697, 825, 545, 9, 745, 825, 737, 737, 745, 305, 673, 153, 673,
+        17, 1065, 257, 1385, 113, 737, 737, 65, 25, 17, 673, 697, 545, 513, 225, 257,
+        1385, 153, 377, 673, 737, 153, 513, 361, 25, 745, 257, 1385, 225, 257, 697, 697,
+    },
+    {
+        737, 737, 697, 9, 257, 737, 65, 1385, 17, 545, 225, 9, 153, 25, 745, 697,
+        305, 153, 9, 25, 377, 153, 17, 545, 697, 673, 17, 737, 1065, 697, 305, 545,
+        737, 9, 1385, 545, 1385, 545, 257, 9, 697, 65, 361, 17, 697, 9, 697, 737,
+        825, 305, 697, 257, 737, 361, 697, 737, 305, 737, 25, 65, 1065, 305, 697, 361,
+        9, 737, 257, 361, 9, 697, 697, 25, 673, 737, 673, 361, 377, 305, 737, 17,
+        737, 545, 257, 697, 737, 697, 745, 9, 113, 65, 305, 25, 737, 17, 153, 257,
+        697, 697, 825, 1385, 697, 545, 545, 737, 377, 737, 737, 17, 9, 745, 377, 65,
+        17, 545, 545, 17, 17, 697, 257, 257, 305, 257, 545, 25, 257, 257, 257, 25,
+        737, 673, 257, 361, 825, 377, 1385, 225, 737, 697, 25, 225, 513, 225, 737, 737,
+        225, 745, 25, 697, 673, 513, 65, 377, 545, 257, 377, 377, 1385, 673, 153, 65,
+        545, 257, 257, 513, 257, 361, 153, 545, 545, 697, 257, 545, 305, 113, 225, 305,
+        225, 113, 113, 153, 737, 113, 9, 257, 257, 65, 1385, 9, 697, 25, 17, 257,
+        17, 9, 697, 113, 737, 545, 17, 673, 697, 17, 737, 545, 545, 545, 737, 737,
+        257, 737, 9, 1385, 113, 545, 257, 513, 17, 697, 545, 257, 545, 257, 225, 737,
+        17, 377, 25, 17, 513, 25, 361, 9, 737, 17, 129, 113, 305, 1065, 697, 545,
+        361, 305, 545, 225, 113, 257, 113, 1385, 17, 225, 697, 737, 545, 361, 25, 1065,
+    },
+    {
+        17, 545, 9, 17, 545, 513, 737, 545, 545, 737, 17, 257, 673, 65, 545, 673,
+        1385, 129, 697, 17, 737, 17, 745, 305, 113, 153, 361, 697, 513, 17, 113, 545,
+        25, 1385, 17, 305, 361, 1385, 305, 25, 361, 225, 673, 1065, 737, 673, 545, 25,
+        737, 737, 737, 673, 737, 377, 1065, 225, 737, 1385, 9, 377, 9, 129, 825, 377,
+        1385, 25, 17, 513, 257, 65, 545, 737, 361, 697, 545, 545, 17, 305, 305, 153,
+        737, 257, 1385, 113, 9, 545, 545, 825, 25, 737, 305, 305, 737, 745, 9, 1385,
+        257, 305, 673, 1065, 745, 17, 545, 257, 1385, 361, 673, 9, 737, 697, 257, 305,
+        257, 377, 153, 17, 737, 825, 9, 697, 153, 377, 113, 113, 25, 9, 737, 153,
+        737, 545, 545, 1385, 545, 737, 17, 545, 737, 737, 545, 825, 9, 673, 737, 545,
+        745, 673, 737, 1385, 1065, 377, 737, 673, 697, 545, 153, 153, 257, 697, 305, 9,
+        737, 697, 225, 9, 737, 113, 305, 257, 737, 17, 737, 257, 137, 1385, 697, 1065,
+        209, 1065, 305, 745, 513, 9, 25, 257, 305, 545, 545, 545, 737, 545, 25, 17,
+        65, 737, 545, 1065, 737, 545, 545, 305, 65, 113, 9, 673, 361, 545, 697, 737,
+        697, 113, 9, 361, 361, 737, 545, 697, 745, 113, 737, 305, 745, 305, 129, 737,
+        737, 737, 545, 697, 113, 257, 25, 9, 545, 673, 257, 673, 17, 257, 545, 697,
+        737, 737, 545, 257, 17, 65, 825, 153, 1065, 545, 545, 545, 305, 25, 113, 737,
+    },
+    {
+        17, 697, 153, 1065, 697, 745, 153, 1065, 697, 697, 137, 545, 513, 737, 697, 697,
+        697, 305, 697, 737, 545, 545, 697, 737, 25, 1065, 737, 697, 25, 305, 113, 377,
+        305, 25, 745, 113, 697, 257, 697, 697, 25, 737, 257, 257, 225, 257, 225, 25,
+        737, 137, 1385, 17, 305, 305, 361, 737, 153, 65, 737, 737, 257, 9, 745, 225,
+        25, 513, 257, 65, 673, 737, 673, 225, 153, 225, 25, 305, 225, 65, 25, 737,
+        257, 745, 65, 225, 153, 25, 737, 737, 65, 737, 25, 825, 825, 225, 697, 745,
+        113, 745, 697, 1065, 745, 361, 745, 745, 377, 1385, 737, 257, 153, 9, 305, 377,
+        737, 377, 9, 745, 257, 673, 673, 673, 257, 113, 545, 745, 513, 673, 1385, 377,
+        545, 697, 697, 225, 305, 377, 257, 153, 673, 25, 65, 305, 305, 305, 361, 225,
+        513, 305, 513, 25, 545, 153, 697, 305, 745, 9, 1385, 745, 65, 113, 673, 305,
+        545, 697, 65, 697, 225, 225, 153, 545, 25, 1385, 1065, 25, 673, 361, 153, 361,
+        673, 305, 25, 257, 137, 17, 257, 377, 745, 737, 513, 225, 17, 737, 737, 17,
+        257, 737, 513, 825, 65, 513, 257, 745, 153, 225, 305, 737, 545, 225, 545, 737,
+        17, 697, 361, 225, 825, 737, 737, 377, 545, 305, 65, 153, 513, 545, 825, 545,
+        17, 305, 745, 257, 305, 545, 9, 113, 1065, 9, 113, 697, 65, 545, 9, 513,
+        257, 737, 9, 737, 153, 257, 545, 305, 697, 545, 737, 9, 697, 153, 257, 737,
+    },
+    {
+        9, 697, 17, 545, 305, 225, 361, 545, 225, 673, 825, 153, 737, 697, 697, 305,
+        673, 513, 737, 377, 257, 745, 25, 737, 257, 257, 737, 745, 25, 25, 9, 697,
+        25, 697, 17, 257, 361, 1385, 361, 1385, 737, 545, 257, 745, 1385, 9, 545, 113,
+        737, 825, 545, 305, 17, 225, 737, 737, 745, 25, 737, 9, 225, 745, 17, 737,
+        9, 745, 737, 65, 737, 9, 17, 673, 737, 257, 25, 17, 745, 305, 305, 745,
+        257, 25, 137, 137, 377, 25, 361, 305, 153, 153, 17, 225, 697, 737, 257, 737,
+        697, 545, 545, 9, 65, 305, 377, 545, 65, 17, 513, 545, 545, 113, 545, 545,
+        825, 153, 17, 1065, 745, 697, 737, 305, 9, 697, 113, 545, 745, 1065, 17, 825,
+        697, 545, 673, 305, 545, 737, 257, 714, 697, 737, 9, 1385, 673, 377, 65, 697,
+        153, 305, 17, 65, 25, 377, 305, 737, 673, 737, 25, 745, 17, 1385, 361, 745,
+        305, 737, 153, 745, 153, 737, 305, 737, 305, 1385, 737, 745, 65, 225, 1385, 17,
+        545, 673, 697, 65, 737, 377, 225, 65, 361, 545, 545, 153, 25, 377, 305, 9,
+        225, 25, 513, 1065, 9, 9, 737, 257, 305, 745, 9, 697, 153, 257, 257, 305,
+        361, 697, 305, 305, 305, 697, 377, 545, 257, 377, 737, 545, 737, 545, 697, 9,
+        257, 673, 737, 545, 153, 145, 545, 737, 545, 17, 377, 25, 545, 153, 225, 697,
+        65, 737, 17, 1385, 145, 113, 113, 1385, 1385, 25, 305, 745, 153, 113, 545, 25,
+    },
+    {
+        17, 545, 737, 673, 545, 697, 697, 545, 361, 697, 737, 545, 697, 697, 305, 697,
+        9, 9, 361, 1385, 65, 225, 257, 9, 745, 737, 305, 25, 697, 745, 1385, 737,
+        113, 25, 257, 225, 25, 17, 673, 145, 513, 25, 673, 153, 1385, 697, 25, 673,
+        737, 65, 225, 697, 673, 225, 225, 673, 257, 673, 361, 305, 673, 65, 305, 17,
+        737, 745, 745, 25, 545, 113, 545, 65, 1065, 745, 305, 1385, 1065, 17, 545, 25,
+        305, 257, 737, 697, 673, 545, 65, 737, 737, 825, 17, 737, 737, 17, 1065, 9,
+        697, 9, 1065, 9, 737, 1385, 1385, 257, 305, 737, 745, 113, 697, 113, 697, 697,
+        377, 113, 673, 25, 305, 257, 737, 137, 153, 113, 25, 513, 257, 25, 305, 737,
+        25, 25, 673, 697, 305, 257, 673, 545, 137, 697, 745, 257, 737, 17, 737, 1385,
+        697, 1385, 65, 545, 257, 545, 673, 65, 697, 697, 673, 9, 17, 377, 225, 305,
+        361, 305, 697, 305, 17, 305, 137, 153, 25, 673, 257, 65, 305, 377, 113, 513,
+        17, 9, 9, 113, 25, 737, 305, 697, 225, 9, 1385, 257, 697, 545, 257, 545,
+        1065, 1385, 377, 697, 65, 697, 257, 1065, 697, 257, 545, 113, 377, 9, 697, 697,
+        697, 697, 257, 697, 737, 545, 545, 1385, 377, 65, 257, 737, 377, 153, 65, 225,
+        17, 257, 225, 153, 1065, 697, 1385, 9, 545, 673, 153, 225, 361, 65, 1385, 209,
+        361, 745, 1385, 17, 697, 737, 225, 25, 153, 305, 25, 25, 697, 65, 745, 153,
+    },
+    {
+        257, 225, 153, 257, 257, 697, 25, 737, 673, 545, 697, 65, 209, 745, 257, 153,
+        697, 257, 1385, 225, 65, 1385, 737, 737, 377, 65, 9, 113, 113, 17, 25, 9,
+        673, 9, 25, 25, 1065, 9, 9, 9, 737, 9, 697, 361, 737, 153, 361, 825,
+        113, 737, 305, 9, 257, 65, 361, 825, 65, 225, 65, 17, 65, 257, 257, 745,
+        153, 153, 697, 9, 697, 25, 745, 737, 361, 361, 377, 113, 305, 305, 673, 1385,
+        361, 113, 745, 113, 225, 305, 1385, 361, 825, 697, 153, 257, 25, 745, 745, 305,
+        113, 377, 153, 65, 257, 697, 673, 697, 225, 737, 361, 17, 737, 737, 745, 305,
+        737, 697, 9, 65, 25, 17, 65, 257, 305, 1385, 305, 25, 25, 113, 697, 305,
+        25, 697, 65, 113, 697, 305, 305, 25, 225, 65, 65, 9, 673, 65, 9, 9,
+        257, 737, 153, 825, 65, 153, 305, 697, 377, 377, 305, 257, 545, 9, 545, 825,
+        697, 737, 25, 737, 153, 305, 545, 673, 737, 25, 153, 737, 697, 257, 25, 361,
+        257, 225, 225, 377, 513, 25, 545, 257, 65, 257, 361, 257, 113, 305, 305, 361,
+        305, 9, 305, 545, 257, 153, 825, 257, 737, 305, 673, 113, 113, 737, 305, 737,
+        17, 113, 737, 25, 257, 17, 737, 745, 65, 305, 545, 113, 113, 745, 225, 545,
+        9, 225, 697, 257, 25, 65, 1385, 9, 697, 9, 17, 545, 737, 225, 257, 377,
+        113, 361, 745, 697, 25, 305, 113, 737, 25, 153, 225, 745, 377, 65, 513, 1385,
+    },
+    {
+        737, 25, 737, 257, 25, 65, 9, 257, 257, 737, 17, 361, 697, 737, 25, 113,
+        737, 377, 1385, 17, 513, 305, 737, 737, 697, 9, 305, 25, 545, 377, 737, 1385,
+        305, 25, 153, 697, 697, 25, 9, 825, 65, 65, 153, 113, 257, 153, 9, 25,
+        697, 737, 257, 25, 257, 257, 9, 9, 673, 65, 697, 697, 745, 673, 737, 737,
+        17, 361, 9, 697, 673, 697, 697, 545, 361, 113, 737, 17, 137, 153, 545, 377,
+        1385, 825, 737, 1385, 737, 737, 225, 697, 697, 9, 65, 697, 65, 697, 697, 153,
+        305, 25, 737, 545, 305, 257, 745, 697, 17, 697, 305, 65, 545, 737, 737, 673,
+        737, 113, 65, 697, 697, 697, 153, 129, 377, 153, 361, 65, 361, 153, 153, 673,
+        305, 257, 257, 745, 65, 225, 305, 17, 377, 25, 697, 377, 745, 305, 305, 225,
+        377, 137, 145, 17, 17, 153, 1385, 25, 673, 545, 137, 545, 17, 17, 17, 257,
+        25, 17, 545, 737, 225, 17, 305, 137, 545, 17, 697, 225, 17, 305, 225, 377,
+        225, 257, 305, 673, 25, 673, 257, 377, 305, 305, 257, 257, 129, 257, 65, 745,
+        673, 737, 737, 153, 257, 257, 225, 17, 737, 17, 737, 153, 1385, 17, 137, 257,
+        737, 305, 17, 737, 513, 361, 377, 65, 225, 361, 673, 9, 65, 697, 257, 745,
+        697, 305, 545, 513, 545, 377, 137, 697, 545, 257, 65, 137, 377, 697, 745, 65,
+        377, 545, 745, 1385, 257, 673, 737, 545, 545, 65, 545, 545, 225, 361, 65, 745,
+    },
+    {
+        745, 1210, 9, 737, 745, 225, 361, 745, 65, 745, 745, 513, 545, 513, 9, 737,
+        257, 737, 9, 17, 65, 257, 513, 545, 9, 737, 9, 745, 745, 257, 257, 257,
+        745, 9, 737, 65, 825, 257, 257, 25, 257, 545, 361, 225, 697, 9, 113, 745,
+        257, 65, 825, 745, 545, 25, 513, 305, 745, 257, 113, 737, 737, 745, 257, 745,
+        257, 257, 745, 9, 545, 17, 17, 65, 25, 257, 305, 145, 745, 545, 545, 513,
+        697, 305, 9, 113, 697, 1385, 697, 9, 673, 697, 737, 305, 257, 697, 697, 257,
+        305, 9, 9, 65, 225, 225, 745, 17, 825, 697, 257, 305, 25, 257, 737, 17,
+        745, 545, 545, 17, 377, 257, 25, 305, 745, 65, 17, 545, 113, 513, 377, 1065,
+        745, 545, 361, 1385, 745, 25, 377, 745, 1385, 513, 65, 113, 513, 9, 545, 673,
+        745, 745, 745, 361, 257, 257, 737, 65, 513, 745, 9, 25, 697, 25, 745, 225,
+        25, 377, 745, 17, 9, 225, 545, 673, 225, 257, 65, 9, 9, 697, 25, 545,
+        513, 737, 545, 113, 1385, 697, 1385, 305, 737, 137, 17, 257, 305, 377, 257, 673,
+        745, 25, 9, 825, 545, 737, 737, 745, 745, 225, 745, 697, 513, 305, 545, 745,
+        17, 697, 745, 697, 673, 745, 545, 25, 113, 513, 257, 745, 305, 673, 737, 9,
+        257, 305, 9, 737, 9, 257, 17, 9, 737, 305, 257, 305, 25, 65, 137, 305,
+        257, 737, 153, 9, 65, 673, 305, 257, 377, 1385, 257, 673, 673, 545, 361, 513,
+    },
+    {
+        65, 745, 9, 65, 305, 697, 361, 1385, 145, 17, 513, 257, 673, 513, 305, 225,
+        145, 737, 225, 257, 737, 9, 257, 25, 65, 1385, 737, 305, 361, 361, 745, 257,
+        257, 737, 697, 113, 113, 65, 257, 257, 145, 361, 745, 257, 697, 153, 825, 225,
+        225, 697, 225, 697, 225, 145, 225, 9, 257, 137, 697, 697, 113, 737, 697, 513,
+        25, 513, 673, 257, 513, 377, 145, 825, 673, 697, 1385, 137, 377, 737, 545, 737,
+        65, 225, 545, 697, 17, 9, 545, 673, 673, 1385, 673, 25, 673, 545, 673, 25,
+        697, 17, 737, 545, 545, 745, 697, 737, 25, 25, 1385, 697, 737, 745, 673, 737,
+        9, 513, 377, 25, 17, 697, 25, 305, 825, 9, 257, 513, 225, 737, 257, 513,
+        25, 673, 257, 673, 697, 305, 225, 65, 745, 65, 257, 17, 697, 137, 9, 545,
+        697, 153, 737, 65, 1385, 673, 697, 1385, 65, 825, 153, 673, 25, 1065, 737, 65,
+        65, 257, 113, 305, 737, 153, 513, 153, 1385, 9, 257, 65, 545, 65, 113, 825,
+        225, 305, 65, 113, 25, 113, 673, 65, 361, 545, 673, 673, 745, 377, 825, 545,
+        145, 25, 697, 113, 113, 153, 513, 225, 1385, 9, 697, 25, 113, 737, 673, 697,
+        225, 1385, 737, 257, 257, 513, 697, 225, 737, 377, 257, 25, 673, 673, 225, 697,
+        697, 513, 25, 25, 737, 697, 225, 673, 745, 257, 25, 257, 673, 25, 697, 305,
+        9, 697, 673, 257, 65, 305, 545, 697, 65, 65, 17, 225, 257, 673, 65, 697,
+    },
+    {
+        305, 305, 545, 257, 673, 65, 545, 737, 257, 673, 513, 257, 697, 305, 25, 737,
+        673, 65, 737, 305, 225, 225, 737, 225, 673, 737, 513, 305, 737, 1065, 745, 225,
+        25, 153, 737, 745, 25, 545, 513, 697, 697, 257, 697, 697, 361, 673, 225, 737,
+        697, 697, 697, 745, 153, 9, 377, 697, 25, 737, 9, 9, 697, 1065, 9, 737,
+        9, 673, 113, 745, 545, 737, 545, 257, 673, 257, 361, 65, 257, 129, 737, 9,
+        737, 257, 113, 361, 361, 745, 257, 257, 9, 745, 257, 673, 17, 257, 9, 9,
+        25, 25, 745, 697, 737, 545, 1385, 113, 225, 257, 377, 545, 257, 305, 377, 257,
+        377, 9, 305, 9, 377, 513, 65, 65, 17, 113, 673, 377, 377, 257, 697, 697,
+        153, 305, 65, 257, 697, 25, 153, 25, 17, 737, 545, 737, 257, 17, 257, 361,
+        737, 1385, 545, 737, 257, 737, 745, 9, 65, 153, 257, 257, 737, 305, 377, 113,
+        9, 745, 113, 361, 545, 673, 737, 545, 673, 9, 113, 65, 377, 9, 697, 825,
+        545, 65, 697, 1065, 737, 257, 257, 697, 1065, 737, 737, 697, 545, 673, 17, 113,
+        545, 9, 1065, 113, 257, 825, 377, 257, 545, 153, 825, 673, 673, 257, 361, 745,
+        737, 513, 745, 257, 305, 153, 257, 737, 745, 513, 153, 225, 825, 697, 737, 257,
+        225, 153, 697, 745, 25, 825, 673, 737, 257, 257, 257, 9, 305, 257, 17, 305,
+        25, 113, 257, 513, 17, 737, 257, 257, 305, 1065, 65, 737, 257, 17, 825, 225,
+    },
+    {
+        545, 377, 697, 361, 257, 113, 697, 513, 377, 305, 113, 25, 113, 9, 9, 737,
+        697, 697, 377, 257, 1065, 257, 153, 153, 673, 257, 257, 513, 697, 225, 513, 697,
+        25, 257, 737, 9, 9, 129, 737, 545, 153, 305, 361, 225, 825, 305, 257, 257,
+        545, 25, 65, 1385, 545, 257, 737, 305, 545, 257, 257, 65, 305, 305, 513, 377,
+        377, 1065, 9, 1065, 305, 513, 745, 9, 745, 257, 305, 697, 9, 305, 737, 1385,
+        673, 9, 513, 737, 17, 673, 305, 9, 545, 225, 305, 257, 257, 257, 697, 9,
+        825, 9, 17, 1065, 825, 737, 225, 257, 113, 1385, 25, 17, 513, 697, 225, 9,
+        1065, 257, 697, 257, 545, 737, 305, 673, 545, 673, 513, 737, 9, 305, 737, 25,
+        257, 113, 697, 673, 257, 737, 153, 153, 737, 153, 1385, 257, 225, 673, 65, 1385,
+        1385, 737, 257, 25, 737, 113, 305, 25, 305, 545, 25, 513, 25, 1385, 65, 513,
+        513, 257, 545, 9, 377, 513, 65, 257, 545, 1385, 1385, 737, 737, 305, 673, 737,
+        737, 113, 25, 737, 113, 65, 697, 697, 545, 1385, 513, 25, 257, 513, 513, 697,
+        25, 25, 697, 257, 25, 673, 673, 65, 257, 697, 673, 697, 25, 9, 361, 673,
+        25, 17, 673, 17, 9, 361, 9, 745, 673, 257, 257, 697, 825, 153, 305, 305,
+        257, 153, 9, 305, 17, 113, 9, 257, 65, 737, 9, 305, 673, 305, 225, 65,
+        697, 257, 25, 65, 25, 1385, 305, 513, 305, 257, 257, 697, 225, 737, 25, 377,
+    },
+    {
+        745, 257, 1385, 65, 305, 305, 153, 9, 305, 673, 257, 9, 737, 257, 737, 17,
+        17, 545, 305, 225, 153, 305, 737, 65, 9, 9, 545, 65, 257, 825, 25, 377,
+        697, 673, 745, 153, 113, 9, 361, 9, 153, 225, 65, 257, 65, 697, 257, 825,
+        361, 377, 361, 305, 377, 361, 9, 745, 225, 545, 305, 673, 697, 745, 153, 697,
+        377, 673, 25, 737, 737, 545, 153, 673, 513, 65, 305, 305, 673, 737, 1065, 361,
+        513, 257, 113, 305, 65, 17, 25, 257, 513, 697, 153, 9, 65, 257, 25, 361,
+        305, 113, 225, 697, 697, 305, 377, 545, 17, 737, 545, 257, 25, 9, 9, 257,
+        257, 545, 9, 113, 305, 737, 377, 513, 377, 25, 513, 377, 737, 209, 673, 545,
+        305, 225, 697, 257, 225, 153, 225, 377, 113, 377, 737, 305, 257, 377, 17, 257,
+        673, 257, 257, 697, 153, 305, 697, 9, 673, 361, 257, 377, 513, 673, 673, 305,
+        257, 377, 737, 25, 257, 153, 257, 673, 113, 697, 65, 545, 1065, 305, 545, 153,
+        9, 545, 545, 225, 257, 545, 17, 737, 257, 737, 25, 697, 1385, 65, 545, 305,
+        305, 17, 545, 745, 361, 65, 257, 225, 361, 257, 17, 673, 17, 673, 745, 673,
+        377, 513, 9, 697, 737, 17, 113, 737, 25, 377, 361, 1065, 257, 377, 825, 673,
+        545, 25, 697, 225, 65, 697, 153, 257, 25, 9, 25, 257, 673, 697, 697, 305,
+        153, 697, 17, 153, 257, 25, 737, 225, 257, 257, 225, 225, 65, 737, 745, 257,
+    },
+    {
+        257, 9, 377, 737, 17, 25, 513, 25, 225, 257, 305, 377, 9, 697, 305, 697,
+        825, 9, 25, 65, 9, 697, 65, 697, 545, 153, 745, 9, 113, 697, 65, 65,
+        361, 305, 745, 513, 65, 305, 65, 17, 257, 697, 257, 545, 697, 9, 257, 673,
+        225, 673, 225, 377, 305, 697, 697, 737, 153, 65, 9, 257, 377, 673, 697, 153,
+        257, 697, 9, 697, 513, 737, 737, 17, 257, 113, 113, 825, 113, 305, 737, 673,
+        113, 257, 257, 225, 9, 257, 673, 257, 113, 697, 697, 305, 113, 737, 737, 697,
+        697, 673, 697, 697, 673, 737, 257, 673, 697, 153, 65, 257, 697, 9, 697, 737,
+        737, 257, 737, 745, 65, 361, 9, 257, 9, 825, 17, 697, 545, 257, 825, 25,
+        257, 673, 257, 225, 153, 1385, 9, 513, 1065, 361, 153, 9, 737, 257, 745, 113,
+        17, 153, 697, 377, 305, 225, 745, 25, 257, 257, 697, 9, 113, 697, 545, 9,
+        17, 113, 25, 9, 737, 257, 697, 257, 153, 697, 361, 145, 673, 17, 697, 545,
+        361, 697, 25, 305, 697, 737, 697, 305, 673, 25, 153, 257, 697, 257, 305, 17,
+        17, 9, 9, 113, 153, 1065, 745, 17, 545, 257, 17, 305, 257, 25, 697, 545,
+        361, 825, 153, 377, 545, 377, 113, 673, 305, 25, 257, 113, 745, 9, 361, 257,
+        513, 305, 745, 9, 9, 825, 545, 697, 305, 513, 153, 17, 9, 305, 545, 825,
+        113, 825, 697, 257, 65, 825, 113, 697, 745, 9, 305, 1450, 377, 257, 305, 737,
+    },
+    {
+        305, 25, 257, 545, 737, 305, 737, 305, 1385, 1065, 1385, 1385, 673, 825, 257, 113,
+        825, 361, 305, 9, 257, 225, 257, 9, 17, 257, 305, 361, 737, 1065, 65, 305,
+        9, 361, 9, 257, 305, 257, 153, 305, 361, 257, 673, 257, 257, 17, 257, 697,
+        545, 361, 737, 9, 153, 257, 673, 697, 257, 9, 377, 737, 361, 113, 257, 65,
+        25, 9, 257, 545, 257, 305, 153, 673, 745, 9, 257, 513, 305, 1065, 17, 737,
+        305, 257, 25, 513, 745, 305, 513, 17, 25, 17, 377, 113, 545, 513, 545, 673,
+        377, 697, 545, 225, 545, 361, 545, 113, 1065, 113, 737, 697, 545, 305, 545, 17,
+        65, 113, 9, 305, 545, 17, 305, 257, 305, 545, 257, 1385, 257, 697, 25, 673,
+        9, 153, 113, 545, 1385, 545, 377, 545, 113, 545, 545, 17, 545, 361, 113, 9,
+        65, 513, 361, 305, 17, 257, 737, 305, 361, 305, 545, 1065, 257, 9, 65, 697,
+        697, 697, 113, 673, 9, 673, 673, 257, 673, 1385, 257, 545, 9, 737, 673, 113,
+        1385, 377, 1385, 153, 257, 25, 377, 257, 697, 697, 737, 257, 153, 25, 697, 745,
+        673, 673, 113, 257, 17, 257, 545, 257, 545, 697, 305, 361, 1065, 745, 737, 257,
+        361, 697, 545, 737, 9, 673, 545, 545, 305, 513, 545, 1065, 745, 673, 65, 257,
+        65, 745, 745, 737, 737, 153, 9, 673, 153, 17, 377, 257, 745, 1385, 361, 1385,
+        545, 377, 745, 545, 697, 257, 225, 737, 737, 113, 377, 257, 737, 25, 25, 65,
+    },
+    {
+        545, 737, 257, 545, 737, 1385, 377, 9, 737, 305, 737, 257, 825, 153, 17, 225,
+        257, 305, 9, 673, 9, 737, 545, 9, 545, 1065, 113, 361, 737, 257, 377, 1065,
+        17, 257, 113, 545, 9, 257, 257, 113, 17, 25, 153, 361, 25, 697, 9, 737,
+        545, 257, 697, 257, 673, 745, 257, 697, 745, 225, 697, 745, 545, 257, 305, 545,
+        9, 361, 697, 153, 737, 257, 745, 737, 673, 17, 545, 305, 9, 545, 1065, 545,
+        9, 673, 257, 257, 257, 9, 9, 697, 737, 361, 1065, 25, 257, 305, 1065, 25,
+        1065, 545, 17, 17, 257, 545, 673, 737, 65, 737, 17, 545, 9, 305, 305, 17,
+        257, 25, 545, 257, 153, 113, 737, 825, 9, 737, 9, 545, 305, 153, 673, 697,
+        225, 545, 257, 673, 225, 737, 745, 697, 545, 257, 513, 737, 545, 697, 545, 25,
+        305, 697, 25, 737, 9, 545, 545, 257, 257, 697, 545, 65, 697, 697, 697, 305,
+        305, 737, 17, 257, 545, 377, 737, 305, 1385, 513, 305, 1065, 1385, 737, 17, 25,
+        225, 9, 377, 825, 1065, 257, 697, 361, 257, 1385, 361, 257, 257, 825, 9, 545,
+        377, 545, 361, 697, 257, 9, 545, 257, 257, 257, 153, 361, 25, 9, 737, 305,
+        65, 153, 1065, 305, 513, 1065, 65, 17, 17, 426, 545, 305, 697, 305, 305, 113,
+        377, 545, 305, 545, 545, 9, 113, 305, 113, 305, 545, 697, 737, 545, 673, 361,
+        25, 9, 377, 9, 1385, 745, 9, 153, 25, 113, 697, 673, 257, 257, 1385, 697,
+    },
+    {
+        257, 257, 513, 545, 305, 745, 697, 113, 745, 305, 737, 17, 9, 65, 65, 153,
+        545, 377, 257, 17, 65, 697, 153, 745, 737, 305, 361, 1065, 257, 361, 9, 377,
+        25, 697, 737, 305, 153, 225, 745, 697, 737, 9, 745, 9, 545, 697, 9, 257,
+        305, 673, 673, 17, 305, 257, 361, 545, 377, 361, 673, 361, 673, 153, 225, 545,
+        257, 377, 737, 737, 673, 545, 377, 257, 113, 25, 673, 1385, 737, 697, 113, 697,
+        377, 1385, 9, 377, 1385, 17, 1065, 697, 361, 9, 361, 377, 257, 305, 745, 377,
+        745, 377, 153, 377, 113, 305, 361, 9, 737, 257, 257, 377, 257, 737, 257, 137,
+        361, 697, 9, 9, 225, 745, 697, 225, 361, 697, 25, 1385, 153, 305, 257, 25,
+        697, 305, 305, 745, 257, 697, 225, 305, 305, 697, 737, 745, 673, 65, 745, 737,
+        737, 737, 361, 153, 377, 737, 377, 737, 257, 745, 697, 737, 257, 65, 545, 673,
+        737, 545, 1065, 673, 673, 673, 17, 9, 737, 737, 737, 673, 545, 737, 697, 305,
+        113, 737, 545, 361, 9, 361, 9, 697, 697, 377, 825, 673, 25, 737, 17, 737,
+        25, 1385, 361, 17, 25, 25, 25, 361, 545, 225, 737, 697, 737, 225, 697, 697,
+        257, 737, 545, 545, 545, 545, 545, 513, 673, 17, 17, 545, 9, 17, 305, 257,
+        25, 361, 257, 9, 25, 257, 305, 545, 25, 225, 257, 1385, 17, 17, 17, 17,
+        17, 137, 225, 737, 697, 673, 137, 697, 225, 673, 137, 361, 737, 17, 545, 65,
+    },
+    {
+        737, 697, 129, 513, 745, 257, 673, 377, 377, 377, 65, 65, 145, 9, 1065, 825,
+        825, 257, 697, 113, 257, 377, 25, 17, 737, 225, 225, 737, 9, 673, 305, 305,
+        17, 25, 697, 697, 305, 113, 209, 697, 825, 305, 225, 257, 697, 305, 697, 17,
+        737, 745, 17, 145, 737, 65, 737, 65, 9, 673, 737, 25, 65, 65, 17, 377,
+        257, 129, 825, 65, 257, 25, 697, 257, 737, 257, 697, 697, 257, 825, 113, 825,
+        737, 257, 377, 9, 697, 17, 9, 697, 225, 305, 305, 153, 65, 377, 1385, 545,
+        225, 25, 65, 129, 113, 305, 25, 513, 697, 513, 25, 697, 1385, 513, 697, 697,
+        25, 137, 9, 9, 113, 513, 257, 257, 65, 825, 673, 825, 113, 113, 697, 737,
+        737, 257, 9, 9, 737, 9, 9, 257, 257, 1065, 737, 697, 305, 673, 513, 25,
+        673, 65, 17, 17, 25, 1065, 545, 1065, 257, 737, 65, 377, 1065, 377, 25, 1385,
+        25, 377, 257, 673, 361, 361, 361, 225, 225, 305, 361, 257, 737, 825, 137, 513,
+        1065, 377, 737, 1385, 737, 673, 225, 673, 545, 545, 361, 513, 305, 113, 9, 257,
+        257, 545, 9, 1385, 257, 65, 65, 361, 153, 153, 545, 113, 153, 377, 113, 257,
+        513, 257, 825, 225, 257, 257, 225, 257, 545, 257, 225, 305, 9, 257, 153, 745,
+        673, 17, 513, 25, 737, 545, 737, 697, 65, 513, 697, 305, 825, 737, 225, 513,
+        737, 377, 17, 377, 65, 257, 305, 545, 545, 145, 137, 17, 225, 825, 257, 513,
+    },
+    {
+        257, 113, 257, 25, 745, 545, 25, 545, 745, 745, 305, 545, 825, 513, 9, 257,
+        673, 825, 745, 825, 697, 1385, 153, 1385, 1385, 545, 305, 513, 737, 17, 25, 225,
+        9, 113, 745, 25, 9, 673, 113, 257, 305, 737, 545, 113, 225, 25, 113, 225,
+        65, 113, 825, 825, 225, 377, 697, 697, 697, 257, 9, 305, 697, 9, 225, 153,
+        697, 225, 697, 673, 17, 65, 113, 825, 305, 825, 697, 737, 737, 1065, 9, 257,
+        361, 361, 305, 361, 673, 1385, 65, 225, 17, 257, 65, 1385, 745, 1065, 257, 25,
+        25, 697, 209, 65, 137, 545, 825, 9, 9, 825, 737, 257, 1065, 145, 9, 113,
+        737, 305, 1385, 305, 737, 305, 65, 153, 25, 361, 545, 825, 745, 1385, 113, 113,
+        153, 737, 697, 1385, 9, 113, 9, 257, 377, 737, 153, 697, 305, 225, 545, 377,
+        697, 153, 209, 25, 697, 17, 225, 25, 153, 305, 697, 113, 745, 545, 257, 697,
+        305, 737, 697, 257, 545, 25, 697, 113, 225, 825, 25, 697, 25, 513, 545, 113,
+        225, 257, 305, 9, 1385, 25, 737, 545, 9, 361, 737, 9, 257, 65, 513, 825,
+        113, 697, 153, 737, 305, 25, 737, 305, 697, 697, 9, 113, 377, 673, 25, 153,
+        545, 1065, 737, 257, 545, 153, 545, 513, 697, 737, 697, 17, 257, 697, 673, 257,
+        697, 825, 257, 25, 545, 1385, 305, 257, 697, 305, 257, 305, 825, 25, 305, 17,
+        545, 745, 825, 257, 257, 377, 305, 257, 257, 545, 113, 257, 305, 545, 737, 25,
+    },
+    {
+        737, 737, 25, 545, 545, 305, 737, 737, 545, 305, 305, 545, 9, 9, 9, 305,
+        9, 113, 9, 9, 113, 113, 225, 225, 377, 673, 113, 25, 9, 545, 1385, 257,
+        65, 25, 9, 737, 361, 225, 113, 361, 153, 361, 17, 361, 153, 153, 697, 257,
+        305, 25, 697, 257, 257, 65, 153, 545, 377, 25, 545, 697, 673, 225, 545, 513,
+        361, 257, 361, 697, 9, 737, 697, 113, 129, 1385, 153, 745, 673, 305, 17, 9,
+        257, 153, 745, 65, 65, 153, 25, 737, 9, 25, 25, 697, 65, 545, 737, 25,
+        65, 65, 673, 697, 737, 305, 305, 1385, 745, 673, 697, 697, 25, 9, 377, 697,
+        305, 305, 9, 737, 361, 225, 737, 737, 25, 25, 737, 697, 113, 305, 137, 825,
+        113, 305, 305, 225, 1385, 737, 25, 745, 745, 377, 673, 737, 737, 9, 545, 65,
+        545, 673, 745, 257, 17, 9, 257, 545, 225, 361, 113, 1385, 1385, 257, 673, 9,
+        1385, 673, 1065, 361, 513, 305, 697, 257, 305, 673, 673, 737, 361, 153, 1065, 545,
+        305, 17, 17, 361, 1385, 305, 305, 257, 737, 673, 137, 257, 745, 737, 361, 1065,
+        17, 25, 737, 737, 153, 737, 673, 1385, 697, 225, 145, 545, 25, 25, 257, 9,
+        113, 737, 1065, 697, 113, 113, 65, 745, 673, 697, 737, 513, 745, 153, 153, 377,
+        745, 737, 737, 305, 225, 1065, 513, 257, 825, 225, 153, 9, 545, 737, 545, 153,
+        17, 737, 257, 65, 305, 65, 825, 377, 17, 225, 745, 361, 9, 377, 745, 1385,
+    },
+    {
+        361, 257, 745, 361, 673, 745, 745, 153, 25, 745, 257, 257, 25, 305, 305, 697,
+        25, 825, 129, 545, 737, 673, 697, 745, 697, 1065, 737, 377, 673, 257, 25, 737,
+        545, 257, 697, 1385, 305, 377, 25, 305, 25, 377, 377, 745, 25, 305, 825, 361,
+        737, 257, 257, 305, 17, 737, 25, 225, 1065, 1065, 25, 745, 113, 257, 673, 257,
+        545, 17, 361, 673, 377, 113, 305, 545, 25, 25, 305, 145, 137, 673, 25, 1065,
+        305, 737, 17, 225, 697, 673, 697, 9, 257, 65, 305, 1065, 153, 25, 673, 17,
+        673, 65, 737, 1065, 17, 737, 697, 737, 545, 305, 9, 737, 745, 17, 257, 737,
+        65, 1385, 697, 65, 361, 1065, 737, 17, 153, 225, 737, 65, 113, 9, 9, 25,
+        825, 1385, 153, 545, 377, 697, 225, 257, 745, 697, 257, 257, 113, 673, 9, 9,
+        25, 225, 305, 745, 545, 545, 737, 25, 9, 305, 737, 113, 737, 25, 377, 17,
+        737, 25, 305, 1385, 737, 1065, 545, 545, 697, 361, 145, 745, 1385, 305, 825, 745,
+        513, 697, 697, 9, 1385, 113, 545, 17, 737, 737, 737, 825, 25, 745, 745, 25,
+        1385, 305, 65, 673, 65, 305, 257, 377, 697, 697, 305, 1385, 305, 1065, 513, 17,
+        225, 257, 377, 377, 361, 697, 25, 25, 9, 25, 257, 745, 25, 153, 697, 113,
+        153, 17, 153, 673, 305, 545, 673, 65, 9, 225, 65, 305, 257, 257, 377, 513,
+        377, 697, 361, 673, 737, 1385, 153, 257, 737, 257, 305, 697, 113, 9, 113, 65,
+    },
+    {
+        17, 673, 17, 25, 113, 25, 153, 25, 17, 361, 697, 673, 745, 225, 1385, 65,
+        9, 17, 737, 737, 113, 673, 1385, 25, 825, 257, 257, 305, 113, 697, 153, 737,
+        745, 153, 225, 65, 737, 737, 737, 545, 9, 673, 513, 545, 1385, 737, 737, 361,
+        697, 545, 545, 825, 25, 1385, 25, 545, 737, 225, 745, 137, 145, 697, 737, 513,
+        513, 305, 745, 257, 257, 257, 153, 1065, 545, 737, 737, 673, 305, 361, 697, 305,
+        225, 361, 17, 17, 17, 737, 113, 257, 257, 545, 9, 377, 673, 673, 745, 17,
+        9, 225, 377, 65, 257, 673, 1385, 153, 1385, 225, 305, 17, 257, 305, 65, 737,
+        9, 25, 673, 1385, 257, 513, 113, 545, 545, 9, 673, 697, 257, 737, 737, 745,
+        737, 9, 65, 257, 377, 1065, 545, 25, 513, 513, 129, 305, 697, 1385, 225, 737,
+        9, 737, 9, 25, 9, 737, 257, 697, 1065, 745, 697, 673, 9, 737, 697, 305,
+        545, 153, 25, 545, 113, 697, 1385, 65, 673, 257, 225, 25, 737, 25, 737, 513,
+        225, 225, 225, 825, 9, 545, 361, 737, 257, 305, 305, 1065, 25, 145, 745, 17,
+        9, 257, 745, 9, 545, 697, 545, 377, 697, 1065, 1385, 377, 25, 9, 113, 697,
+        1065, 9, 545, 153, 257, 377, 153, 257, 377, 257, 113, 25, 225, 697, 129, 305,
+        697, 9, 697, 737, 697, 737, 745, 113, 545, 745, 113, 257, 225, 137, 697, 257,
+        545, 225, 545, 305, 113, 305, 1385, 113, 25, 737, 737, 257, 697, 153, 697, 545,
+    },
+    {
+        153, 257, 697, 673, 745, 737, 697, 545, 225, 377, 17, 65, 9, 697, 9, 9,
+        65, 745, 545, 745, 153, 65, 257, 257, 9, 545, 1385, 17, 137, 745, 697, 25,
+        257, 25, 225, 305, 745, 25, 825, 17, 305, 737, 9, 825, 9, 737, 377, 25,
+        17, 9, 513, 673, 745, 257, 257, 673, 65, 697, 697, 513, 137, 153, 697, 1385,
+        305, 545, 9, 361, 745, 209, 25, 65, 545, 305, 1065, 1065, 697, 737, 673, 257,
+        513, 305, 745, 737, 153, 737, 673, 697, 737, 17, 145, 113, 361, 305, 257, 361,
+        1065, 361, 513, 9, 1065, 737, 545, 361, 305, 113, 1385, 65, 9, 545, 545, 9,
+        737, 9, 673, 305, 737, 9, 697, 737, 545, 1385, 305, 17, 9, 825, 697, 545,
+        737, 737, 545, 17, 153, 17, 137, 1385, 17, 17, 305, 257, 545, 1385, 745, 737,
+        697, 305, 25, 9, 9, 697, 513, 737, 65, 257, 113, 545, 153, 257, 9, 737,
+        361, 65, 545, 377, 545, 257, 305, 513, 17, 9, 545, 545, 737, 153, 9, 9,
+        545, 65, 225, 737, 825, 257, 1385, 1065, 225, 113, 673, 257, 25, 257, 145, 825,
+        737, 377, 25, 545, 673, 361, 305, 737, 513, 305, 153, 257, 745, 697, 305, 250,
+        745, 673, 673, 545, 129, 209, 545, 9, 697, 737, 545, 545, 697, 737, 697, 697,
+        305, 65, 257, 153, 113, 737, 745, 17, 225, 361, 9, 113, 113, 673, 673, 1385,
+        697, 17, 209, 513, 737, 153, 697, 257, 257, 137, 697, 257, 545, 673, 697, 17,
+    },
+    {
+        257, 1385, 1065, 1065, 673, 17, 697, 9, 113, 745, 737, 225, 737, 545, 305, 305,
+        545, 745, 673, 9, 305, 361, 825, 153, 545, 737, 545, 737, 305, 545, 545, 737,
+        673, 737, 697, 113, 17, 737, 697, 673, 737, 361, 745, 697, 513, 697, 305, 113,
+        745, 697, 697, 17, 9, 257, 1385, 513, 257, 17, 697, 305, 745, 697, 17, 697,
+        305, 513, 697, 305, 9, 113, 697, 673, 545, 737, 697, 745, 153, 17, 17, 697,
+        825, 697, 257, 545, 673, 305, 17, 545, 25, 361, 545, 545, 697, 17, 737, 17,
+        305, 305, 377, 153, 737, 257, 257, 513, 153, 545, 9, 25, 673, 65, 305, 673,
+        65, 9, 129, 305, 257, 737, 737, 17, 257, 17, 17, 745, 377, 9, 545, 25,
+        9, 737, 745, 545, 361, 145, 153, 25, 673, 1385, 1385, 1065, 153, 225, 737, 737,
+        305, 673, 113, 737, 257, 25, 737, 673, 737, 673, 673, 257, 737, 17, 745, 1385,
+        361, 361, 17, 377, 257, 361, 1065, 305, 361, 25, 65, 225, 545, 825, 113, 673,
+        737, 257, 225, 65, 737, 513, 17, 305, 697, 361, 1065, 257, 545, 225, 225, 545,
+        257, 65, 153, 153, 377, 257, 673, 9, 113, 697, 377, 65, 377, 737, 697, 25,
+        673, 745, 697, 25, 17, 17, 745, 361, 737, 1385, 697, 257, 737, 545, 513, 305,
+        697, 737, 225, 673, 17, 9, 737, 1385, 745, 673, 673, 377, 673, 257, 745, 697,
+        257, 305, 825, 9, 673, 545, 305, 673, 9, 737, 305, 737, 25, 153, 145, 17,
+    },
+    {
+        9, 545, 361, 9, 257, 225, 545, 257, 1385, 361, 697, 697, 153, 25, 737, 737,
+        305, 65, 737, 113, 65, 113, 17, 1385, 257, 9, 361, 305, 745, 673, 673, 737,
+        305, 697, 745, 673, 545, 545, 697, 697, 65, 113, 113, 513, 17, 17, 737, 153,
+        361, 225, 1385, 113, 737, 737, 9, 673, 673, 1385, 825, 673, 1385, 697, 377, 1385,
+        65, 145, 153, 257, 1385, 25, 745, 737, 377, 25, 129, 697, 513, 305, 545, 113,
+        745, 545, 745, 737, 305, 9, 545, 17, 737, 153, 1065, 1385, 361, 737, 745, 1385,
+        361, 1065, 545, 737, 673, 745, 545, 737, 9, 257, 113, 257, 257, 113, 361, 737,
+        513, 745, 697, 65, 17, 673, 65, 545, 1385, 737, 737, 825, 697, 25, 1065, 737,
+        305, 153, 697, 225, 9, 545, 25, 545, 737, 1385, 697, 9, 225, 1065, 1065, 305,
+        1385, 545, 17, 673, 737, 225, 17, 113, 737, 65, 825, 545, 17, 17, 745, 745,
+        737, 1385, 737, 113, 257, 25, 9, 673, 745, 113, 9, 9, 25, 25, 65, 137,
+        697, 1385, 257, 113, 25, 225, 673, 225, 737, 305, 697, 697, 673, 257, 737, 305,
+        9, 1385, 545, 745, 257, 257, 745, 745, 737, 697, 745, 545, 25, 697, 745, 545,
+        25, 257, 745, 545, 745, 257, 9, 673, 113, 257, 225, 225, 673, 673, 153, 697,
+        225, 377, 545, 673, 257, 17, 361, 697, 305, 305, 17, 737, 113, 305, 9, 1065,
+        545, 1385, 257, 545, 9, 25, 25, 65, 697, 545, 113, 737, 305, 65, 25, 673,
+    },
+    {
+        305, 545, 9, 697, 673, 737, 25, 697, 257, 545, 697, 257, 257, 545, 745, 545,
+        673, 1065, 305, 745, 17, 1065, 17, 257, 305, 153, 17, 745, 361, 697, 305, 697,
+        745, 697, 25, 697, 673, 825, 697, 65, 545, 257, 697, 697, 697, 225, 737, 225,
+        9, 737, 305, 737, 9, 545, 25, 673, 673, 65, 25, 745, 673, 305, 257, 257,
+        545, 17, 825, 225, 825, 545, 257, 745, 145, 513, 745, 545, 538, 737, 513, 737,
+        673, 697, 545, 9, 545, 113, 545, 305, 737, 737, 17, 1385, 65, 25, 1385, 65,
+        257, 17, 673, 737, 737, 153, 377, 737, 153, 25, 737, 9, 25, 361, 377, 225,
+        9, 305, 825, 257, 65, 737, 257, 257, 305, 257, 545, 1065, 257, 1065, 673, 305,
+        305, 737, 745, 25, 137, 825, 737, 1065, 305, 113, 697, 65, 225, 225, 737, 257,
+        153, 9, 113, 305, 513, 545, 545, 257, 737, 225, 361, 65, 1385, 361, 377, 257,
+        257, 1065, 225, 737, 745, 113, 825, 377, 545, 257, 673, 153, 737, 545, 825, 153,
+        129, 361, 825, 673, 513, 1065, 305, 673, 257, 745, 305, 145, 377, 1065, 257, 377,
+        737, 25, 697, 513, 545, 257, 65, 9, 513, 513, 825, 9, 545, 513, 25, 697,
+        305, 9, 225, 305, 737, 737, 257, 697, 673, 673, 305, 737, 153, 257, 9, 9,
+        673, 697, 697, 697, 513, 305, 545, 113, 153, 513, 113, 737, 697, 25, 25, 65,
+        65, 153, 697, 9, 225, 225, 361, 737, 697, 377, 737, 65, 113, 257, 305, 737,
+    },
+    {
+        673, 377, 377, 513, 673, 113, 113, 361, 257, 545, 153, 65, 513, 113, 737, 737,
+        17, 737, 153, 153, 361, 737, 113, 737, 737, 153, 25, 697, 225, 65, 737, 113,
+        377, 65, 17, 1065, 737, 1065, 825, 305, 9, 225, 113, 25, 9, 825, 737, 305,
+        673, 17, 513, 697, 697, 697, 257, 9, 697, 737, 65, 545, 545, 1385, 153, 25,
+        305, 673, 9, 225, 545, 153, 225, 305, 257, 305, 25, 305, 65, 257, 361, 361,
+        545, 545, 153, 1065, 745, 697, 137, 257, 17, 25, 9, 825, 65, 697, 153, 305,
+        65, 9, 257, 153, 697, 225, 1065, 257, 113, 9, 1385, 9, 153, 545, 153, 25,
+        697, 697, 545, 545, 697, 257, 65, 305, 257, 9, 305, 225, 737, 697, 737, 545,
+        545, 737, 361, 113, 361, 361, 361, 153, 17, 305, 305, 545, 377, 153, 737, 545,
+        305, 225, 745, 745, 745, 225, 9, 9, 305, 257, 305, 745, 113, 697, 737, 257,
+        305, 545, 9, 1385, 545, 113, 737, 697, 145, 65, 673, 225, 305, 745, 737, 377,
+        673, 257, 305, 377, 65, 305, 697, 673, 305, 1385, 305, 673, 697, 697, 9, 305,
+        377, 305, 377, 737, 377, 745, 9, 25, 697, 305, 305, 545, 65, 113, 737, 377,
+        305, 673, 305, 673, 305, 25, 305, 257, 25, 305, 377, 65, 257, 257, 9, 545,
+        673, 377, 9, 586, 377, 377, 25, 545, 17, 673, 545, 9, 825, 673, 697, 257,
+        257, 153, 545, 17, 9, 377, 257, 545, 25, 545, 737, 697, 305, 545, 737, 545,
+    },
+    {
+        737, 737, 65, 361, 673, 673, 305, 17, 305, 361, 545, 65, 17, 25, 113, 545,
+        305, 737, 1065, 545, 737, 9, 673, 113, 305, 545, 737, 145, 361, 737, 737, 9,
+        9, 737, 737, 305, 545, 825, 25, 737, 257, 545, 361, 545, 745, 9, 737, 9,
+        257, 545, 737, 737, 9, 25, 17, 9, 17, 545, 257, 257, 257, 377, 257, 257,
+        257, 377, 361, 305, 65, 697, 113, 737, 697, 825, 225, 257, 377, 737, 305, 737,
+        257, 737, 737, 673, 257, 225, 153, 545, 673, 153, 65, 257, 113, 257, 25, 257,
+        737, 545, 545, 737, 17, 17, 9, 673, 545, 9, 17, 65, 17, 377, 673, 17,
+        305, 17, 377, 737, 1385, 9, 257, 113, 745, 257, 745, 697, 17, 737, 545, 377,
+        145, 153, 113, 737, 697, 257, 513, 673, 1385, 737, 113, 305, 257, 1065, 25, 697,
+        145, 513, 737, 9, 113, 65, 153, 25, 737, 513, 673, 673, 9, 137, 737, 545,
+        25, 305, 545, 1385, 1385, 377, 9, 153, 17, 305, 737, 257, 737, 65, 17, 25,
+        9, 305, 513, 673, 25, 545, 9, 1385, 545, 361, 697, 113, 737, 825, 737, 257,
+        225, 257, 25, 25, 257, 305, 673, 113, 257, 1385, 305, 673, 65, 257, 257, 257,
+        673, 257, 697, 305, 305, 545, 697, 9, 153, 17, 225, 737, 545, 545, 225, 9,
+        545, 9, 17, 17, 145, 257, 113, 545, 361, 225, 113, 697, 673, 737, 257, 257,
+        545, 17, 737, 113, 545, 825, 25, 361, 257, 737, 737, 17, 545, 377, 825, 545,
+    },
+    {
+        745, 737, 1385, 545, 113, 257, 9, 305, 225, 113, 17, 17, 377, 737, 745, 545,
+        745, 545, 673, 257, 545, 113, 9, 153, 25, 257, 737, 305, 737, 545, 545, 113,
+        737, 737, 257, 737, 225, 25, 673, 697, 745, 745, 9, 257, 745, 305, 257, 257,
+        697, 697, 257, 545, 377, 545, 257, 137, 137, 305, 257, 737, 545, 305, 745, 257,
+        545, 1385, 65, 545, 257, 9, 545, 257, 65, 257, 545, 697, 145, 737, 305, 305,
+        257, 673, 153, 17, 257, 1385, 257, 257, 257, 673, 113, 257, 225, 9, 545, 257,
+        113, 65, 9, 545, 305, 305, 305, 257, 825, 737, 137, 257, 225, 17, 545, 737,
+        737, 9, 1065, 825, 673, 65, 113, 17, 257, 17, 737, 737, 513, 737, 305, 17,
+        65, 257, 545, 257, 697, 9, 1385, 25, 697, 737, 153, 257, 737, 145, 25, 1385,
+        25, 737, 25, 1065, 737, 697, 25, 545, 825, 17, 257, 737, 65, 257, 737, 65,
+        737, 305, 65, 361, 1065, 305, 305, 17, 113, 1065, 9, 673, 113, 545, 737, 545,
+        305, 1065, 305, 17, 209, 305, 737, 825, 545, 145, 697, 545, 9, 361, 9, 361,
+        305, 257, 377, 17, 225, 257, 9, 545, 257, 9, 257, 65, 257, 25, 673, 257,
+        153, 737, 737, 513, 697, 9, 377, 9, 305, 17, 25, 257, 9, 17, 65, 377,
+        673, 377, 545, 737, 257, 377, 545, 25, 17, 545, 257, 305, 1385, 737, 673, 1385,
+        377, 737, 17, 513, 9, 9, 145, 673, 257, 257, 825, 65, 257, 361, 513, 1385,
+    },
+    {
+        737, 9, 9, 338, 25, 697, 257, 9, 113, 9, 737, 745, 25, 65, 17, 305,
+        545, 545, 737, 1385, 145, 737, 545, 25, 257, 137, 737, 65, 745, 225, 545, 745,
+        65, 9, 545, 737, 153, 9, 673, 745, 305, 745, 257, 305, 745, 113, 257, 673,
+        697, 225, 305, 737, 673, 257, 25, 377, 673, 17, 545, 305, 17, 17, 697, 545,
+        545, 17, 697, 17, 65, 697, 65, 305, 673, 25, 697, 65, 1385, 153, 9, 545,
+        361, 257, 257, 737, 737, 9, 25, 17, 113, 737, 113, 737, 737, 153, 17, 145,
+        25, 545, 17, 737, 513, 377, 305, 225, 545, 17, 17, 737, 257, 305, 361, 545,
+        17, 1385, 17, 153, 65, 257, 361, 737, 257, 153, 25, 137, 225, 825, 225, 377,
+        825, 737, 65, 745, 9, 545, 17, 745, 745, 745, 745, 137, 745, 737, 825, 153,
+        737, 305, 113, 745, 225, 545, 737, 737, 745, 25, 113, 17, 305, 153, 257, 737,
+        361, 25, 377, 113, 737, 17, 1385, 225, 17, 361, 113, 1385, 257, 257, 145, 257,
+        9, 153, 257, 145, 377, 225, 361, 745, 113, 9, 513, 361, 113, 737, 25, 745,
+        17, 361, 697, 697, 17, 377, 225, 257, 305, 545, 257, 305, 377, 257, 305, 737,
+        545, 257, 9, 153, 153, 673, 9, 25, 257, 257, 697, 257, 25, 25, 9, 113,
+        225, 377, 545, 745, 305, 9, 361, 113, 25, 25, 257, 305, 257, 65, 305, 545,
+        25, 737, 153, 257, 697, 361, 25, 305, 9, 737, 257, 361, 377, 9, 257, 697,
+    },
+    {
+        737, 153, 25, 1385, 257, 257, 153, 737, 257, 65, 257, 737, 225, 9, 1385, 737,
+        305, 257, 545, 257, 153, 65, 9, 737, 129, 545, 697, 257, 257, 153, 257, 361,
+        737, 377, 25, 257, 545, 153, 257, 17, 257, 361, 113, 225, 153, 377, 257, 377,
+        145, 305, 153, 9, 113, 377, 513, 65, 745, 361, 17, 737, 257, 257, 305, 17,
+        257, 697, 697, 257, 257, 377, 305, 673, 257, 697, 9, 361, 65, 305, 9, 9,
+        25, 153, 257, 377, 225, 65, 697, 361, 257, 361, 257, 9, 257, 737, 257, 737,
+        257, 9, 737, 377, 25, 545, 9, 825, 545, 545, 25, 17, 25, 257, 545, 113,
+        257, 257, 697, 305, 361, 257, 377, 673, 9, 673, 737, 545, 257, 305, 673, 65,
+        25, 25, 257, 113, 673, 25, 65, 545, 257, 305, 737, 673, 305, 673, 25, 17,
+        545, 257, 113, 65, 697, 377, 9, 25, 545, 257, 9, 737, 673, 305, 673, 113,
+        257, 1385, 697, 673, 65, 673, 257, 113, 673, 25, 17, 673, 673, 305, 257, 737,
+        145, 257, 257, 257, 225, 153, 1385, 513, 65, 305, 361, 25, 305, 225, 257, 113,
+        737, 225, 673, 737, 673, 113, 113, 737, 825, 697, 745, 153, 65, 513, 113, 305,
+        257, 225, 673, 257, 673, 257, 257, 361, 225, 257, 9, 153, 825, 305, 697, 377,
+        737, 305, 65, 545, 305, 65, 257, 257, 513, 257, 377, 673, 513, 545, 65, 697,
+        225, 257, 305, 113, 25, 305, 65, 673, 153, 545, 65, 305, 673, 305, 9, 113,
+    },
+    {
+        25, 513, 825, 545, 153, 545, 257, 745, 9, 697, 737, 305, 25, 673, 745, 113,
+        305, 673, 1385, 1385, 25, 305, 673, 825, 305, 825, 697, 697, 697, 17, 305, 25,
+        1385, 673, 113, 153, 257, 673, 737, 65, 257, 25, 257, 225, 257, 257, 65, 257,
+        737, 65, 65, 25, 737, 257, 257, 257, 25, 25, 305, 113, 113, 305, 361, 257,
+        65, 225, 1065, 1065, 113, 257, 113, 305, 65, 25, 673, 113, 673, 257, 65, 113,
+        305, 825, 225, 697, 257, 153, 25, 697, 697, 25, 113, 257, 9, 545, 513, 305,
+        257, 673, 257, 225, 257, 697, 153, 257, 1065, 153, 113, 305, 65, 25, 545, 361,
+        25, 257, 65, 153, 25, 25, 305, 305, 697, 113, 673, 673, 225, 697, 65, 25,
+        377, 257, 65, 153, 153, 257, 305, 25, 673, 65, 25, 305, 1385, 737, 825, 697,
+        697, 257, 737, 257, 25, 25, 65, 1385, 697, 697, 545, 1385, 257, 697, 545, 1065,
+        545, 825, 113, 673, 673, 25, 257, 545, 513, 673, 697, 9, 377, 65, 361, 673,
+        113, 65, 65, 377, 697, 1065, 697, 137, 305, 305, 113, 513, 129, 737, 745, 513,
+        673, 697, 697, 113, 257, 737, 113, 65, 737, 737, 25, 257, 377, 305, 1385, 737,
+        545, 65, 545, 361, 1065, 9, 513, 9, 113, 673, 113, 145, 825, 673, 745, 1065,
+        513, 673, 257, 17, 17, 673, 513, 65, 697, 65, 137, 257, 361, 513, 737, 225,
+        153, 377, 377, 225, 257, 1065, 145, 153, 257, 257, 737, 513, 257, 257, 9, 225,
+    },
+    {
+        145, 377, 305, 545, 377, 737, 513, 673, 257, 257, 257, 9, 697, 737, 9, 737,
+        737, 737, 257, 1385, 361, 673, 257, 737, 697, 257, 257, 697, 257, 17, 1385, 25,
+        17, 513, 737, 225, 673, 377, 825, 225, 377, 153, 697, 225, 697, 1065, 1065, 305,
+        737, 545, 25, 25, 9, 737, 737, 17, 9, 361, 257, 361, 737, 153, 257, 737,
+        737, 113, 377, 257, 545, 737, 697, 545, 25, 257, 1385, 545, 545, 257, 305, 257,
+        153, 697, 361, 361, 697, 377, 9, 513, 17, 737, 305, 257, 145, 737, 305, 17,
+        697, 225, 697, 697, 697, 697, 25, 257, 377, 545, 65, 1065, 257, 145, 697, 1065,
+        17, 377, 513, 697, 257, 257, 737, 17, 257, 697, 737, 673, 9, 257, 257, 305,
+        257, 673, 697, 305, 257, 361, 697, 825, 153, 17, 377, 1385, 697, 25, 257, 25,
+        361, 305, 737, 9, 225, 737, 545, 257, 697, 257, 697, 545, 377, 25, 25, 225,
+        257, 153, 697, 697, 25, 737, 153, 153, 153, 153, 129, 153, 153, 25, 153, 225,
+        25, 1065, 825, 825, 257, 25, 257, 737, 1065, 153, 361, 9, 1065, 697, 65, 25,
+        377, 673, 737, 737, 673, 545, 737, 377, 745, 673, 257, 1385, 113, 257, 737, 113,
+        737, 305, 545, 737, 361, 1385, 113, 145, 17, 257, 257, 305, 737, 1385, 697, 25,
+        25, 825, 113, 257, 737, 305, 305, 257, 65, 145, 65, 225, 257, 65, 257, 113,
+        9, 737, 673, 305, 17, 65, 737, 745, 153, 305, 825, 737, 305, 257, 697, 545,
+    },
+    {
+        113, 9, 9, 113, 225, 17, 825, 65, 305, 545, 545, 153, 737, 545, 673, 113,
+        257, 673, 65, 65, 113, 305, 113, 65, 737, 737, 113, 377, 1385, 9, 25, 9,
+        257, 673, 361, 697, 9, 17, 697, 377, 697, 153, 25, 257, 225, 17, 65, 697,
+        737, 257, 305, 737, 25, 513, 1385, 113, 737, 113, 737, 697, 153, 825, 737, 113,
+        9, 65, 9, 737, 25, 25, 113, 737, 9, 257, 737, 737, 145, 153, 17, 145,
+        545, 17, 673, 65, 113, 1385, 825, 737, 377, 737, 25, 697, 545, 113, 9, 257,
+        737, 9, 113, 673, 745, 737, 377, 257, 137, 257, 25, 25, 9, 257, 257, 65,
+        9, 697, 257, 25, 697, 257, 1065, 673, 545, 737, 737, 145, 697, 305, 9, 153,
+        737, 745, 545, 9, 545, 257, 113, 145, 745, 153, 153, 697, 697, 737, 737, 697,
+        697, 737, 113, 65, 673, 737, 9, 17, 737, 745, 1065, 673, 1385, 513, 361, 513,
+        153, 361, 545, 825, 545, 9, 153, 737, 25, 17, 545, 153, 1385, 305, 737, 17,
+        113, 673, 153, 225, 153, 9, 153, 1385, 65, 257, 737, 697, 513, 377, 257, 9,
+        513, 737, 17, 545, 673, 257, 305, 545, 17, 545, 305, 545, 377, 825, 697, 305,
+        513, 257, 697, 737, 737, 25, 65, 545, 697, 361, 737, 361, 377, 17, 697, 305,
+        377, 305, 737, 153, 545, 673, 697, 737, 153, 545, 673, 225, 673, 377, 257, 113,
+        257, 225, 697, 825, 25, 737, 225, 545, 65, 305, 737, 673, 737, 65, 737, 745,
+    },
+    {
+        1065, 153, 145, 9, 305, 737, 737, 17, 513, 545, 545, 9, 113, 745, 545, 1065,
+        25, 257, 257, 737, 1385, 545, 737, 673, 737, 153, 745, 25, 697, 697, 737, 257,
+        17, 673, 737, 257, 1385, 673, 545, 65, 153, 545, 153, 257, 1385, 257, 745, 9,
+        697, 225, 65, 745, 737, 9, 513, 361, 745, 257, 513, 697, 257, 25, 737, 673,
+        737, 25, 257, 697, 673, 545, 361, 257, 257, 737, 65, 673, 257, 225, 257, 737,
+        377, 737, 305, 737, 257, 745, 257, 545, 65, 257, 361, 737, 361, 737, 113, 113,
+        673, 113, 257, 17, 377, 9, 225, 25, 257, 745, 697, 25, 25, 737, 113, 257,
+        545, 305, 25, 737, 113, 305, 745, 513, 9, 697, 225, 257, 17, 737, 9, 825,
+        257, 697, 697, 737, 113, 225, 257, 25, 113, 257, 257, 25, 513, 113, 545, 65,
+        17, 545, 545, 113, 673, 25, 737, 361, 513, 9, 745, 673, 25, 25, 737, 737,
+        137, 257, 17, 113, 305, 225, 25, 737, 697, 257, 697, 737, 305, 153, 305, 545,
+        113, 225, 825, 737, 697, 305, 737, 737, 825, 1065, 545, 9, 737, 697, 745, 745,
+        825, 545, 305, 9, 745, 737, 153, 25, 9, 737, 9, 737, 697, 1546, 737, 697,
+        545, 305, 305, 673, 737, 697, 65, 257, 697, 225, 673, 153, 361, 257, 257, 153,
+        697, 361, 825, 65, 545, 673, 513, 25, 257, 361, 737, 1385, 17, 377, 673, 745,
+        1065, 65, 9, 545, 737, 25, 737, 113, 545, 825, 673, 673, 305, 257, 737, 737,
+    },
+    {
+        225, 361, 257, 545, 65, 737, 257, 361, 225, 1065, 545, 145, 305, 65, 377, 737,
+        673, 153, 545, 1065, 25, 825, 361, 737, 737, 673, 225, 377, 17, 737, 305, 65,
+        737, 257, 545, 377, 1065, 17, 113, 513, 737, 697, 825, 1385, 65, 257, 825, 113,
+        9, 745, 225, 513, 697, 153, 113, 17, 153, 225, 737, 9, 257, 153, 257, 113,
+        305, 257, 9, 257, 257, 305, 113, 737, 737, 545, 257, 225, 17, 9, 9, 257,
+        257, 153, 257, 25, 257, 225, 113, 673, 361, 257, 745, 737, 361, 697, 737, 225,
+        737, 153, 153, 305, 673, 545, 257, 745, 545, 545, 65, 305, 745, 113, 9, 737,
+        9, 513, 513, 153, 305, 257, 545, 17, 305, 25, 513, 697, 225, 9, 745, 513,
+        737, 305, 257, 25, 545, 113, 745, 697, 305, 737, 545, 1065, 257, 257, 673, 9,
+        697, 545, 545, 673, 225, 737, 257, 545, 745, 513, 737, 545, 545, 545, 305, 25,
+        697, 305, 225, 1065, 745, 737, 737, 377, 137, 65, 737, 9, 513, 673, 697, 9,
+        825, 65, 17, 737, 257, 513, 673, 545, 257, 737, 257, 113, 25, 377, 17, 257,
+        113, 697, 745, 697, 1385, 257, 737, 153, 1385, 9, 737, 25, 113, 153, 17, 305,
+        17, 305, 361, 25, 1385, 257, 113, 545, 1385, 737, 113, 513, 257, 697, 545, 673,
+        9, 17, 697, 737, 305, 257, 305, 545, 113, 745, 225, 697, 225, 737, 25, 377,
+        697, 113, 153, 257, 257, 113, 697, 257, 305, 25, 737, 305, 377, 65, 113, 25,
+    },
+    {
+        697, 513, 697, 225, 697, 697, 673, 225, 305, 745, 257, 225, 137, 225, 545, 737,
+        257, 697, 513, 513, 113, 513, 65, 257, 25, 257, 257, 153, 825, 257, 65, 737,
+        65, 737, 673, 257, 305, 737, 305, 377, 745, 25, 113, 545, 697, 113, 377, 545,
+        9, 257, 697, 745, 697, 17, 153, 377, 697, 513, 361, 1385, 825, 1385, 257, 17,
+        65, 545, 129, 17, 697, 361, 745, 513, 737, 9, 697, 377, 545, 65, 113, 1385,
+        1385, 361, 1065, 305, 145, 305, 257, 113, 257, 17, 737, 65, 545, 737, 513, 9,
+        17, 1385, 361, 257, 25, 673, 9, 17, 513, 113, 745, 673, 673, 17, 113, 257,
+        17, 737, 745, 305, 65, 305, 9, 513, 17, 545, 257, 305, 257, 153, 257, 257,
+        545, 737, 745, 225, 137, 377, 673, 745, 9, 113, 225, 545, 697, 9, 513, 697,
+        257, 737, 825, 1385, 1065, 113, 9, 673, 697, 9, 257, 153, 225, 9, 225, 9,
+        377, 257, 1385, 737, 17, 113, 697, 513, 9, 9, 9, 1385, 17, 257, 257, 697,
+        737, 737, 113, 825, 545, 305, 377, 745, 305, 9, 257, 9, 129, 361, 1385, 825,
+        697, 9, 209, 257, 113, 545, 377, 545, 697, 9, 137, 745, 745, 697, 153, 1385,
+        697, 65, 9, 257, 737, 697, 137, 513, 673, 25, 673, 25, 113, 745, 737, 25,
+        361, 305, 153, 9, 697, 545, 25, 697, 257, 257, 25, 697, 545, 545, 513, 9,
+        153, 257, 673, 25, 697, 17, 305, 225, 9, 673, 225, 697, 9, 545, 545, 25,
+    },
+    {
+        513, 9, 697, 825, 17, 225, 9, 361, 673, 673, 737, 113, 545, 737, 305, 257,
+        697, 673, 697, 65, 545, 257, 673, 305, 257, 65, 737, 737, 65, 305, 825, 257,
+        225, 113, 129, 257, 65, 9, 513, 305, 361, 9, 697, 305, 17, 737, 697, 257,
+        9, 673, 257, 697, 153, 113, 545, 737, 65, 377, 113, 673, 361, 65, 153, 737,
+        137, 257, 545, 65, 257, 17, 257, 305, 825, 17, 17, 673, 153, 737, 513, 825,
+        545, 305, 305, 673, 25, 257, 745, 697, 697, 305, 257, 513, 9, 225, 697, 65,
+        737, 25, 697, 153, 153, 697, 545, 513, 697, 145, 697, 545, 305, 697, 153, 673,
+        737, 25, 545, 305, 545, 377, 25, 825, 697, 25, 673, 225, 697, 257, 697, 257,
+        737, 305, 113, 257, 697, 305, 377, 737, 257, 65, 257, 225, 697, 113, 673, 25,
+        9, 545, 361, 65, 745, 825, 737, 25, 545, 377, 153, 113, 305, 65, 25, 257,
+        825, 153, 377, 153, 673, 737, 673, 305, 1385, 377, 513, 361, 17, 113, 825, 225,
+        737, 673, 257, 673, 377, 153, 513, 225, 153, 153, 737, 257, 745, 113, 305, 65,
+        737, 113, 153, 697, 9, 673, 745, 225, 9, 545, 113, 153, 825, 225, 65, 545,
+        513, 697, 145, 745, 737, 737, 25, 305, 737, 825, 257, 25, 113, 697, 65, 737,
+        513, 257, 257, 545, 65, 65, 545, 17, 673, 9, 17, 65, 377, 745, 257, 9,
+        305, 737, 25, 25, 113, 137, 737, 1065, 257, 697, 225, 737, 697, 113, 697, 513,
+    },
+    {
+        545, 9, 697, 257, 25, 377, 377, 145, 545, 25, 697, 361, 545, 697, 513, 305,
+        1065, 113, 697, 673, 305, 137, 673, 257, 825, 25, 745, 153, 737, 65, 513, 513,
+        25, 545, 377, 697, 25, 257, 305, 257, 545, 305, 17, 225, 113, 65, 305, 305,
+        745, 257, 673, 737, 513, 673, 9, 145, 25, 673, 257, 65, 9, 17, 17, 137,
+        65, 745, 697, 257, 361, 745, 745, 257, 153, 377, 825, 113, 305, 825, 825, 697,
+        377, 153, 737, 305, 153, 1065, 153, 113, 745, 697, 153, 737, 305, 65, 257, 545,
+        697, 25, 305, 697, 225, 697, 65, 697, 225, 25, 673, 65, 17, 697, 545, 257,
+        697, 737, 25, 153, 697, 25, 545, 257, 257, 305, 137, 65, 305, 697, 825, 1546,
+        745, 745, 9, 9, 9, 745, 737, 153, 17, 153, 9, 673, 513, 153, 17, 1065,
+        9, 545, 545, 305, 745, 545, 9, 65, 257, 825, 257, 225, 545, 697, 377, 153,
+        1065, 17, 1385, 377, 377, 361, 25, 545, 377, 745, 9, 513, 697, 697, 113, 9,
+        305, 737, 737, 25, 673, 697, 113, 9, 513, 737, 1385, 737, 737, 17, 737, 1385,
+        545, 153, 545, 673, 737, 1385, 225, 737, 1385, 737, 513, 673, 697, 9, 673, 225,
+        113, 825, 113, 513, 17, 673, 25, 1385, 65, 673, 513, 113, 1385, 225, 545, 545,
+        17, 25, 225, 113, 17, 113, 1385, 129, 745, 9, 9, 737, 17, 153, 1385, 25,
+        1065, 1385, 545, 17, 305, 745, 513, 745, 257, 825, 377, 1385, 113, 745, 697, 513,
+    },
+    {
+        361, 377, 17, 513, 305, 737, 697, 9, 737, 737, 25, 545, 1385, 17, 737, 145,
+        25, 697, 673, 17, 513, 673, 17, 113, 113, 673, 513, 17, 361, 257, 697, 65,
+        545, 673, 1385, 737, 257, 737, 737, 65, 145, 9, 153, 225, 513, 737, 1065, 257,
+        225, 305, 361, 737, 737, 257, 305, 25, 145, 673, 65, 257, 257, 65, 697, 137,
+        113, 257, 153, 153, 361, 305, 697, 697, 25, 545, 65, 697, 745, 586, 9, 9,
+        545, 145, 377, 737, 377, 9, 305, 673, 545, 25, 1385, 153, 545, 9, 9, 257,
+        225, 65, 737, 257, 25, 545, 65, 825, 737, 545, 225, 225, 257, 737, 65, 697,
+        737, 305, 25, 257, 225, 697, 113, 545, 697, 9, 545, 737, 257, 737, 1065, 545,
+        25, 737, 737, 737, 65, 737, 697, 1385, 1385, 825, 257, 9, 137, 17, 305, 9,
+        737, 673, 737, 17, 377, 737, 1385, 1385, 137, 545, 113, 305, 257, 65, 137, 545,
+        737, 9, 1065, 697, 113, 65, 225, 9, 9, 737, 737, 361, 825, 145, 305, 65,
+        545, 737, 257, 17, 697, 545, 697, 697, 697, 257, 673, 257, 9, 305, 825, 737,
+        673, 737, 673, 673, 545, 737, 305, 377, 17, 257, 377, 257, 25, 737, 305, 25,
+        17, 257, 697, 737, 25, 65, 9, 17, 1385, 9, 17, 305, 257, 737, 305, 545,
+        25, 697, 697, 825, 545, 257, 305, 305, 737, 737, 545, 825, 361, 545, 745, 1385,
+        361, 225, 737, 697, 25, 737, 697, 697, 137, 153, 1385, 65, 65, 17, 1385, 65,
+    },
+    {
+        545, 305, 745, 25, 545, 257, 113, 257, 225, 745, 697, 673, 257, 17, 9, 361,
+        17, 257, 737, 825, 257, 113, 697, 697, 65, 737, 1385, 697, 9, 697, 545, 17,
+        737, 745, 745, 737, 697, 745, 153, 1385, 1385, 513, 737, 545, 737, 137, 65, 113,
+        545, 737, 697, 697, 65, 305, 225, 737, 153, 225, 1385, 129, 545, 305, 745, 1385,
+        745, 697, 697, 9, 137, 361, 65, 697, 697, 737, 361, 697, 153, 17, 17, 17,
+        153, 673, 673, 697, 113, 257, 305, 25, 673, 305, 697, 65, 305, 113, 361, 361,
+        513, 745, 745, 745, 153, 737, 113, 17, 737, 377, 65, 25, 673, 1065, 65, 65,
+        1385, 1065, 673, 305, 545, 825, 153, 737, 9, 825, 1385, 257, 65, 153, 737, 737,
+        113, 153, 305, 17, 225, 737, 153, 737, 113, 113, 305, 545, 137, 137, 17, 377,
+        673, 65, 673, 113, 745, 737, 9, 113, 673, 545, 513, 153, 113, 257, 225, 513,
+        305, 697, 257, 1065, 153, 145, 673, 673, 9, 9, 745, 305, 305, 153, 65, 305,
+        209, 113, 377, 113, 153, 545, 225, 377, 153, 513, 113, 697, 17, 673, 545, 305,
+        305, 305, 25, 113, 17, 545, 673, 65, 1385, 305, 697, 1385, 1065, 361, 1385, 673,
+        377, 1385, 9, 17, 25, 513, 1065, 737, 9, 1385, 377, 361, 113, 377, 737, 377,
+        153, 545, 9, 65, 1385, 65, 1385, 1065, 361, 17, 1385, 737, 113, 305, 305, 545,
+        545, 545, 305, 737, 257, 737, 9, 697, 225, 737, 737, 737, 225, 137, 737, 545,
+    },
+    {
+        17, 737, 65, 673, 513, 545, 9, 17, 545, 737, 545, 377, 9, 513, 673, 17,
+        737, 1385, 361, 65, 65, 65, 225, 225, 697, 25, 305, 697, 673, 673, 145, 145,
+        1385, 545, 513, 9, 737, 737, 513, 65, 737, 225, 697, 113, 305, 113, 17, 513,
+        305, 697, 113, 25, 737, 737, 17, 17, 305, 113, 113, 225, 697, 113, 257, 257,
+        25, 65, 697, 113, 17, 673, 513, 257, 545, 673, 737, 9, 113, 145, 145, 737,
+        1385, 737, 737, 257, 737, 545, 545, 737, 737, 9, 113, 113, 305, 513, 697, 697,
+        225, 257, 745, 25, 737, 17, 673, 377, 545, 737, 17, 9, 1065, 745, 153, 545,
+        225, 697, 697, 825, 673, 737, 65, 673, 17, 545, 9, 545, 545, 1385, 377, 65,
+        673, 153, 9, 17, 737, 697, 697, 225, 305, 305, 305, 113, 17, 737, 305, 513,
+        737, 225, 225, 113, 17, 737, 737, 513, 113, 737, 145, 257, 737, 145, 825, 745,
+        65, 9, 17, 697, 25, 1065, 225, 673, 361, 65, 377, 361, 545, 257, 225, 9,
+        361, 113, 697, 305, 545, 545, 305, 153, 9, 1385, 737, 737, 9, 513, 9, 361,
+        697, 545, 697, 225, 225, 697, 153, 153, 153, 697, 153, 9, 361, 545, 361, 737,
+        257, 153, 9, 305, 9, 9, 737, 697, 225, 153, 153, 361, 361, 361, 361, 9,
+        9, 25, 305, 65, 9, 113, 257, 9, 545, 257, 1065, 737, 737, 9, 737, 361,
+        361, 9, 737, 257, 737, 257, 153, 305, 113, 153, 25, 113, 9, 153, 9, 65,
+    },
+    {
+        17, 1065, 113, 305, 305, 153, 737, 113, 25, 545, 737, 305, 145, 737, 697, 545,
+        25, 153, 825, 145, 153, 305, 65, 9, 737, 545, 737, 513, 377, 9, 305, 257,
+        153, 545, 153, 737, 113, 361, 257, 1385, 377, 145, 825, 737, 17, 17, 113, 17,
+        257, 17, 17, 545, 361, 1385, 377, 25, 9, 113, 153, 377, 545, 513, 697, 9,
+        545, 737, 1385, 745, 113, 745, 153, 737, 545, 305, 9, 113, 257, 9, 25, 65,
+        737, 673, 1065, 25, 737, 113, 1385, 545, 257, 361, 17, 745, 737, 745, 25, 545,
+        697, 257, 825, 9, 65, 305, 113, 113, 113, 545, 1065, 737, 25, 361, 737, 305,
+        9, 153, 9, 65, 737, 145, 1065, 545, 305, 697, 305, 545, 153, 153, 65, 145,
+        737, 825, 305, 377, 17, 545, 377, 25, 513, 377, 9, 25, 737, 745, 153, 697,
+        545, 305, 745, 9, 257, 825, 9, 513, 377, 545, 361, 153, 825, 153, 225, 113,
+        17, 361, 305, 137, 137, 361, 545, 737, 545, 361, 225, 545, 745, 737, 225, 673,
+        65, 113, 257, 25, 545, 257, 257, 225, 545, 1065, 9, 737, 1385, 257, 65, 697,
+        737, 153, 153, 513, 113, 737, 673, 225, 673, 305, 225, 257, 737, 225, 257, 305,
+        257, 825, 305, 225, 257, 305, 697, 257, 257, 361, 737, 9, 153, 113, 113, 9,
+        697, 745, 225, 113, 257, 1065, 113, 65, 545, 673, 9, 305, 145, 17, 153, 257,
+        737, 697, 257, 65, 17, 697, 305, 9, 673, 745, 697, 17, 113, 545, 113, 305,
+    },
+    {
+        145, 25, 545, 9, 697, 257, 257, 9, 225, 513, 113, 697, 257, 513, 673, 673,
+        737, 361, 9, 737, 377, 737, 1385, 225, 25, 225, 673, 361, 17, 673, 17, 737,
+        113, 673, 545, 257, 513, 1065, 9, 377, 113, 113, 9, 673, 25, 257, 697, 225,
+        113, 545, 25, 65, 737, 737, 257, 545, 9, 673, 257, 9, 697, 545, 697, 257,
+        745, 737, 25, 225, 25, 673, 153, 257, 737, 545, 17, 153, 9, 545, 697, 257,
+        65, 697, 113, 25, 65, 545, 113, 737, 697, 257, 305, 737, 737, 257, 225, 257,
+        737, 257, 697, 113, 545, 305, 9, 305, 545, 17, 697, 225, 745, 737, 113, 545,
+        25, 673, 1065, 153, 697, 257, 9, 9, 361, 305, 257, 257, 113, 825, 305, 737,
+        113, 545, 745, 737, 305, 17, 697, 17, 225, 225, 697, 25, 737, 545, 673, 305,
+        673, 673, 513, 257, 257, 9, 25, 225, 257, 513, 9, 1385, 137, 697, 673, 9,
+        153, 697, 25, 25, 257, 305, 9, 545, 377, 1385, 1385, 1385, 737, 377, 737, 513,
+        113, 305, 153, 153, 257, 113, 65, 513, 17, 545, 17, 513, 377, 113, 377, 225,
+        153, 513, 673, 737, 9, 697, 225, 545, 225, 305, 25, 513, 153, 745, 697, 697,
+        545, 65, 257, 9, 113, 153, 513, 697, 377, 377, 673, 513, 673, 697, 9, 153,
+        513, 513, 113, 361, 545, 1065, 745, 65, 513, 153, 361, 113, 225, 257, 361, 1065,
+        113, 153, 153, 1065, 361, 145, 1065, 673, 377, 545, 737, 305, 225, 257, 9, 9,
+    },
+    {
+        113, 697, 153, 257, 113, 225, 9, 257, 673, 257, 9, 305, 65, 17, 697, 305,
+        673, 697, 257, 153, 225, 745, 9, 745, 745, 9, 545, 697, 673, 673, 825, 17,
+        513, 825, 153, 697, 1065, 65, 65, 825, 545, 545, 65, 17, 65, 65, 305, 25,
+        737, 737, 377, 737, 697, 545, 377, 257, 697, 545, 9, 737, 377, 745, 673, 673,
+        377, 513, 17, 153, 225, 745, 545, 737, 545, 697, 737, 113, 673, 1385, 697, 1385,
+        377, 25, 225, 153, 745, 673, 545, 25, 737, 257, 737, 65, 1065, 305, 153, 17,
+        113, 65, 305, 737, 17, 673, 9, 17, 113, 745, 305, 9, 153, 737, 225, 697,
+        1385, 17, 697, 257, 361, 361, 825, 737, 225, 745, 17, 545, 545, 17, 225, 697,
+        113, 153, 673, 225, 361, 153, 305, 1385, 673, 65, 153, 737, 377, 225, 825, 257,
+        113, 225, 361, 257, 305, 377, 9, 65, 65, 113, 673, 9, 17, 257, 145, 137,
+        1385, 257, 257, 737, 697, 697, 113, 737, 737, 153, 1385, 305, 513, 545, 545, 377,
+        17, 697, 361, 513, 545, 65, 305, 113, 745, 9, 257, 9, 673, 737, 825, 257,
+        377, 377, 9, 1385, 673, 9, 225, 17, 113, 697, 9, 9, 513, 745, 25, 697,
+        257, 545, 737, 9, 257, 673, 257, 545, 825, 25, 305, 65, 673, 377, 257, 65,
+        697, 361, 825, 737, 513, 697, 305, 25, 305, 697, 697, 257, 697, 745, 257, 257,
+        825, 17, 737, 65, 9, 9, 17, 113, 17, 257, 257, 697, 257, 257, 153, 153,
+    },
+    {
+        17, 673, 257, 1385, 1385, 737, 25, 1065, 257, 17, 697, 737, 673, 673, 305, 153,
+        145, 737, 361, 545, 545, 545, 1385, 17, 9, 1065, 545, 1385, 673, 17, 1385, 225,
+        9, 697, 745, 9, 9, 513, 257, 113, 113, 737, 377, 737, 673, 673, 1385, 1065,
+        9, 697, 137, 697, 17, 745, 305, 113, 673, 305, 9, 745, 545, 673, 153, 305,
+        305, 257, 305, 545, 257, 737, 257, 513, 545, 153, 737, 673, 545, 153, 305, 545,
+        9, 17, 257, 113, 9, 361, 305, 697, 545, 745, 545, 257, 545, 361, 377, 17,
+        513, 257, 9, 257, 377, 377, 737, 697, 25, 697, 9, 137, 1065, 305, 737, 17,
+        9, 697, 697, 697, 745, 257, 545, 145, 697, 377, 697, 545, 737, 65, 305, 737,
+        113, 697, 361, 153, 17, 153, 225, 825, 697, 737, 257, 361, 153, 153, 17, 225,
+        113, 377, 305, 513, 1385, 145, 113, 257, 17, 513, 305, 305, 545, 257, 545, 545,
+        377, 697, 697, 305, 697, 9, 113, 377, 9, 17, 305, 305, 737, 673, 697, 673,
+        257, 361, 513, 25, 377, 825, 825, 65, 305, 9, 9, 257, 361, 65, 153, 25,
+        113, 1385, 1385, 9, 145, 673, 361, 17, 673, 305, 153, 9, 137, 673, 113, 377,
+        737, 225, 673, 697, 153, 545, 153, 745, 745, 737, 1385, 545, 377, 9, 697, 257,
+        17, 377, 697, 257, 377, 673, 737, 361, 697, 257, 153, 737, 361, 257, 305, 361,
+        1065, 737, 9, 361, 745, 153, 737, 257, 17, 673, 377, 361, 1385, 257, 9, 737,
+    },
+    {
+        361, 737, 305, 305, 225, 17, 257, 153, 737, 737, 257, 361, 361, 1385, 209, 65,
+        377, 1065, 697, 745, 361, 113, 1385, 697, 153, 257, 377, 737, 25, 673, 545, 25,
+        65, 305, 737, 377, 257, 737, 737, 737, 737, 113, 737, 113, 737, 65, 1385, 145,
+        377, 137, 257, 737, 17, 545, 305, 697, 257, 737, 737, 17, 697, 1065, 745, 377,
+        1065, 545, 545, 257, 25, 697, 17, 825, 145, 697, 305, 305, 113, 305, 113, 225,
+        1385, 305, 737, 153, 305, 305, 153, 545, 305, 305, 113, 305, 113, 145, 145, 513,
+        17, 1385, 9, 697, 305, 225, 697, 225, 9, 361, 737, 257, 225, 673, 673, 153,
+        65, 697, 673, 305, 305, 113, 737, 737, 673, 697, 737, 257, 513, 65, 513, 9,
+        673, 305, 737, 737, 673, 257, 697, 65, 673, 113, 377, 305, 673, 737, 257, 305,
+        9, 129, 25, 745, 1065, 737, 673, 113, 17, 113, 145, 305, 745, 361, 25, 113,
+        737, 17, 737, 225, 513, 745, 17, 737, 257, 1385, 305, 65, 673, 361, 17, 737,
+        737, 545, 1385, 9, 17, 25, 113, 545, 1065, 697, 305, 17, 673, 545, 17, 25,
+        25, 737, 737, 737, 305, 697, 113, 513, 113, 113, 737, 113, 745, 545, 377, 113,
+        25, 305, 113, 257, 137, 737, 737, 209, 25, 257, 697, 737, 697, 153, 9, 257,
+        737, 1385, 305, 737, 113, 9, 305, 737, 17, 153, 737, 9, 17, 361, 305, 697,
+        737, 377, 305, 545, 545, 113, 745, 257, 737, 737, 697, 113, 545, 545, 737, 225,
+    },
+    {
+        257, 697, 545, 737, 305, 257, 737, 257, 737, 737, 225, 825, 17, 745, 737, 745,
+        65, 737, 737, 697, 153, 697, 17, 697, 9, 737, 737, 673, 673, 697, 697, 825,
+        305, 305, 737, 745, 9, 209, 737, 673, 153, 257, 377, 65, 697, 737, 545, 737,
+        697, 25, 673, 737, 545, 113, 9, 257, 145, 377, 545, 17, 257, 377, 697, 17,
+        1385, 153, 697, 305, 17, 145, 737, 545, 113, 1385, 673, 745, 137, 513, 153, 225,
+        673, 25, 377, 737, 9, 17, 17, 145, 377, 673, 25, 745, 1385, 737, 737, 1385,
+        697, 305, 737, 305, 17, 737, 737, 257, 697, 697, 305, 305, 737, 697, 17, 257,
+        737, 17, 745, 377, 9, 697, 305, 697, 305, 545, 25, 305, 305, 737, 25, 697,
+        737, 25, 305, 225, 25, 225, 257, 305, 257, 305, 745, 745, 737, 697, 25, 673,
+        697, 825, 673, 697, 305, 673, 305, 9, 545, 737, 305, 745, 697, 9, 257, 697,
+        305, 673, 697, 737, 25, 745, 745, 17, 25, 361, 745, 745, 361, 225, 673, 673,
+        745, 361, 737, 697, 673, 745, 25, 361, 361, 673, 745, 745, 745, 745, 17, 745,
+        257, 825, 361, 17, 17, 305, 377, 113, 113, 17, 17, 513, 17, 9, 697, 825,
+        25, 17, 17, 737, 673, 65, 545, 113, 745, 745, 673, 65, 25, 737, 257, 737,
+        545, 737, 673, 745, 737, 673, 737, 697, 113, 65, 25, 737, 737, 737, 257, 137,
+        257, 257, 25, 737, 745, 257, 737, 65, 697, 257, 361, 361, 361, 745, 745, 737,
+    },
+    {
+        25, 673, 257, 1385, 257, 257, 745, 137, 153, 113, 153, 737, 257, 113, 65, 745,
+        825, 257, 257, 377, 377, 65, 361, 113, 737, 225, 25, 377, 673, 737, 113, 113,
+        9, 9, 361, 361, 1385, 361, 65, 113, 257, 673, 9, 9, 737, 9, 113, 1385,
+        545, 305, 17, 545, 737, 113, 9, 545, 545, 737, 697, 153, 737, 673, 17, 1385,
+        1385, 513, 545, 17, 257, 545, 1385, 257, 825, 825, 257, 257, 305, 257, 305, 305,
+        673, 305, 25, 25, 25, 17, 737, 737, 545, 153, 257, 545, 257, 25, 737, 257,
+        113, 697, 697, 25, 673, 545, 737, 825, 305, 737, 25, 737, 737, 25, 737, 825,
+        257, 257, 673, 737, 737, 737, 145, 1385, 737, 25, 257, 65, 25, 305, 737, 25,
+        25, 17, 737, 305, 697, 153, 113, 257, 737, 737, 25, 673, 1385, 745, 225, 1385,
+        225, 737, 745, 697, 377, 513, 65, 697, 65, 697, 377, 513, 673, 673, 153, 377,
+        737, 25, 17, 305, 545, 737, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1625, 1633, 1641, 1649, 1657, 1665, 1673, 1681, 1689, 1697, 0, 0, 0, 0, 0, 0,
+        0, 137, 153, 25, 65, 145, 361, 377, 17, 57, 305, 513, 697, 745, 825, 209,
+        225, 673, 1065, 9, 113, 129, 1305, 1385, 545, 737, 257, 0, 0, 0, 0, 0,
+        0, 137, 153, 25, 65, 145, 361, 377, 17, 57, 305, 513, 697, 745, 825, 209,
+        225, 673, 1065, 9, 113, 129, 1305, 1385, 545, 737, 257, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+static constexpr char s_pool[] =
+    "-shchchidscshitsuaebabebibobpbuczdadedjdodtdzfugagegigjgoguhahehkhohxijjijxkakekikokqkuljlslymam"
+    "emimomunanengninjnonuoepapepipopspuqorarerirorusasesosssxsztatethtovavevivovuwawewiwoxjyayeyoyuz"
+    "azczezhzozu0123456789"
+;
+
+int transliterate(ushort code, const char** text) {
+    int row = s_blockRows[code >> 8];
+    if (row < 0) {
+        return -1;
+    }
+    ushort value = s_rows[row][code & 0xFF];
+    if (value == 0) {
+        return -1;
+    }
+    *text = s_pool + (value >> 3);
+    return value & 7;
+}
+
+}
@@ -20,7 +20,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <QtGlobal>
 
-// simplified Chinese
-extern const ushort zhCN_min;
-extern const ushort zhCN_max;
-extern const char*  zhCN_table;
+namespace launchy {
+
+// Longest transliteration of a single code point
+#define TRANSLITERATION_MAX_LENGTH 4
+
+// Look up the ASCII text a code point outside of ASCII is searched by,
+// the tables are generated by tables/gen_unicode_table.py.
+// Return the length of the text stored at text, possibly 0 for characters
+// which are dropped, or -1 when the code point is kept as it is.
+int transliterate(ushort code, const char** text);
+
+}
@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+#
+# LaunchyQt
+# Copyright (C) 2018 Samson Wang
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Generate UnicodeTable.cpp, the transliteration tables of CatItem::convertSearchName.
+
+Usage: gen_unicode_table.py [output]
+
+Every code point of the basic multilingual plane outside of ASCII maps to
+the ASCII text it is searched by, or is kept as it is.
+  - CJK unified ideographs: pin yin initials, all of them for polyphones
+  - hiragana and katakana: Hepburn romaji
+  - Cyrillic and Greek: transliteration
+  - Latin letters with diacritics, ligatures and full width forms: folded
+"""
+
+import os
+import sys
+import unicodedata
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUTPUT = os.path.join(HERE, os.pardir, 'UnicodeTable.cpp')
+
+# Longest transliteration, the C++ side reserves this much per character
+MAX_LENGTH = 4
+
+ZHCN_MIN = 0x4E00
+
+CYRILLIC = {
+    'а': 'a', 'б': 'b', 'в': 'v', 'г': 'g', 'д': 'd', 'е': 'e', 'ё': 'e',
+    'ж': 'zh', 'з': 'z', 'и': 'i', 'й': 'y', 'к': 'k', 'л': 'l', 'м': 'm',
+    'н': 'n', 'о': 'o', 'п': 'p', 'р': 'r', 'с': 's', 'т': 't', 'у': 'u',
+    'ф': 'f', 'х': 'kh', 'ц': 'ts', 'ч': 'ch', 'ш': 'sh', 'щ': 'shch',
+    'ъ': '', 'ы': 'y', 'ь': '', 'э': 'e', 'ю': 'yu', 'я': 'ya',
+    # Ukrainian and Belarusian
+    'є': 'ye', 'і': 'i', 'ї': 'yi', 'ґ': 'g', 'ў': 'u',
+    # Serbian and Macedonian
+    'ђ': 'dj', 'ј': 'j', 'љ': 'lj', 'њ': 'nj', 'ћ': 'c', 'џ': 'dz',
+    'ѓ': 'gj', 'ќ': 'kj', 'ѕ': 'dz',
+}
+
+GREEK = {
+    'α': 'a', 'β': 'v', 'γ': 'g', 'δ': 'd', 'ε': 'e', 'ζ': 'z', 'η': 'i',
+    'θ': 'th', 'ι': 'i', 'κ': 'k', 'λ': 'l', 'μ': 'm', 'ν': 'n', 'ξ': 'x',
+    'ο': 'o', 'π': 'p', 'ρ': 'r', 'σ': 's', 'ς': 's', 'τ': 't', 'υ': 'y',
+    'φ': 'f', 'χ': 'ch', 'ψ': 'ps', 'ω': 'o',
+}
+
+# Latin letters without a decomposition into ASCII
+LATIN = {
+    'ß': 'ss', 'æ': 'ae', 'œ': 'oe', 'ø': 'o', 'đ': 'd', 'ð': 'd',
+    'þ': 'th', 'ħ': 'h', 'ı': 'i', 'ł': 'l', 'ŋ': 'ng', 'ƒ': 'f',
+}
+
+# Unicode names the kana by Kunrei-shiki syllables, these become Hepburn
+KANA_HEPBURN = {
+    'si': 'shi', 'zi': 'ji', 'ti': 'chi', 'di': 'ji', 'tu': 'tsu',
+    'du': 'zu', 'hu': 'fu',
+}
+
+LATIN_RANGES = [(0x00C0, 0x024F), (0x1E00, 0x1EFF), (0xFF01, 0xFF5E)]
+GREEK_RANGES = [(0x0370, 0x03FF), (0x1F00, 0x1FFF)]
+CYRILLIC_RANGE = (0x0400, 0x04FF)
+KANA_RANGES = [(0x3041, 0x3096), (0x30A1, 0x30FA)]
+
+
+def read_lines(name):
+    with open(os.path.join(HERE, name), encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if line:
+                yield line
+
+
+def zhcn(table):
+    initials = ''.join(read_lines('zhCN_initials.txt'))
+    for i, initial in enumerate(initials):
+        table[ZHCN_MIN + i] = initial
+
+    for line in read_lines('zhCN_polyphones.txt'):
+        code, readings = line.split()
+        code = int(code[2:], 16)
+        # The reading of the initials table ranks first
+        first = table[code]
+        table[code] = first + ''.join(r for r in readings if r != first)
+
+
+def kana(table):
+    for first, last in KANA_RANGES:
+        for code in range(first, last + 1):
+            name = unicodedata.name(chr(code), '')
+            if not name:
+                continue
+            syllable = name.split(' LETTER ')[-1].lower()
+            if syllable == 'small tu':
+                # The sokuon only doubles the next consonant
+                table[code] = ''
+                continue
+            syllable = syllable.replace('small ', '')
+            table[code] = KANA_HEPBURN.get(syllable, syllable)
+    # Prolonged sound mark
+    table[0x30FC] = ''
+
+
+def cyrillic(table):
+    first, last = CYRILLIC_RANGE
+    for code in range(first, last + 1):
+        c = chr(code).lower()
+        base = unicodedata.normalize('NFD', c)[0]
+        if base in CYRILLIC:
+            table[code] = CYRILLIC[base]
+
+
+def greek(table):
+    for first, last in GREEK_RANGES:
+        for code in range(first, last + 1):
+            c = chr(code).lower()
+            base = unicodedata.normalize('NFD', c)[0]
+            if base in GREEK:
+                table[code] = GREEK[base]
+
+
+def latin(table):
+    for first, last in LATIN_RANGES:
+        for code in range(first, last + 1):
+            c = chr(code).lower()
+            if c in LATIN:
+                table[code] = LATIN[c]
+                continue
+            folded = ''.join(ch for ch in unicodedata.normalize('NFKD', c)
+                             if ord(ch) < 0x80 and ch.isalnum())
+            if folded:
+                table[code] = folded.lower()
+
+
+def build_pool(texts):
+    # Offset 0 is never used, so a packed value is 0 only for kept characters
+    pool = '-'
+    # Longest first, ties by text, so that the pool does not depend on the hash seed
+    for text in sorted(set(texts), key=lambda t: (-len(t), t)):
+        if text and pool.find(text, 1) == -1:
+            pool += text
+    return pool
+
+
+def generate(table):
+    for code, text in table.items():
+        assert len(text) <= MAX_LENGTH, (hex(code), text)
+        assert all(ord(c) < 0x80 for c in text), (hex(code), text)
+
+    pool = build_pool(table.values())
+    assert len(pool) < (1 << 13), len(pool)
+
+    def packed(code):
+        text = table.get(code)
+        if text is None:
+            return 0
+        offset = pool.find(text, 1) if text else 1
+        return (offset << 3) | len(text)
+
+    blocks = [-1] * 256
+    rows = []
+    for block in range(256):
+        values = [packed((block << 8) | i) for i in range(256)]
+        if any(values):
+            blocks[block] = len(rows)
+            rows.append(values)
+    return blocks, rows, pool
+
+
+HEADER = '''/*
+LaunchyQt
+Copyright (C) 2018 Samson Wang
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Generated by tables/gen_unicode_table.py, do not edit
+
+#include "UnicodeTable.h"
+
+namespace launchy {
+
+'''
+
+FOOTER = '''
+int transliterate(ushort code, const char** text) {
+    int row = s_blockRows[code >> 8];
+    if (row < 0) {
+        return -1;
+    }
+    ushort value = s_rows[row][code & 0xFF];
+    if (value == 0) {
+        return -1;
+    }
+    *text = s_pool + (value >> 3);
+    return value & 7;
+}
+
+}
+'''
+
+
+def write(output, blocks, rows, pool):
+    with open(output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(HEADER)
+        f.write('static_assert(TRANSLITERATION_MAX_LENGTH == %d, '
+                '"regenerate the transliteration tables");\n\n' % MAX_LENGTH)
+
+        f.write('// Row of s_rows for each block of 256 code points, -1 when no\n'
+                '// code point of the block is transliterated\n')
+        f.write('static constexpr short s_blockRows[256] = {\n')
+        for i in range(0, 256, 16):
+            f.write('    ' + ', '.join('%d' % b for b in blocks[i:i + 16]) + ',\n')
+        f.write('};\n\n')
+
+        f.write('// 0 for a code point kept as it is, otherwise the offset of its\n'
+                '// transliteration in s_pool shifted left by 3 and its length\n')
+        f.write('static constexpr ushort s_rows[%d][256] = {\n' % len(rows))
+        for values in rows:
+            f.write('    {\n')
+            for i in range(0, 256, 16):
+                f.write('        ' + ', '.join('%d' % v for v in values[i:i + 16]) + ',\n')
+            f.write('    },\n')
+        f.write('};\n\n')
+
+        f.write('static constexpr char s_pool[] =\n')
+        for i in range(0, len(pool), 96):
+            f.write('    "%s"\n' % pool[i:i + 96])
+        f.write(';\n')
+        f.write(FOOTER)
+
+
+def main():
+    output = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_OUTPUT
+    table = {}
+    latin(table)
+    greek(table)
+    cyrillic(table)
+    kana(table)
+    zhcn(table)
+    blocks, rows, pool = generate(table)
+    write(output, blocks, rows, pool)
+    print('%s: %d code points in %d blocks, pool of %d characters'
+          % (output, len(table), len(rows), len(pool)))
+
+
+if __name__ == '__main__':
+    main()